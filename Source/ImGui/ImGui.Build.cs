@@ -79,6 +79,7 @@ public class ImGui : ModuleRules
 					"EditorStyle",
 					"Settings",
 					"UnrealEd",
+					"WorkspaceMenuStructure",
 				}
 				);
 		}
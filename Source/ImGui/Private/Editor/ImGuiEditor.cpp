@@ -6,16 +6,26 @@
 
 #include "ImGuiCanvasSizeInfoCustomization.h"
 #include "ImGuiKeyInfoCustomization.h"
+#include "ImGuiModuleManager.h"
 #include "ImGuiModuleSettings.h"
+#include "SImGuiEditorWidget.h"
+#include "Utilities/WorldContextIndex.h"
 
+#include <Framework/Application/SlateApplication.h>
+#include <Framework/Docking/TabManager.h>
 #include <ISettingsModule.h>
 #include <Modules/ModuleManager.h>
+#include <Widgets/Docking/SDockTab.h>
+#include <WorkspaceMenuStructure.h>
+#include <WorkspaceMenuStructureModule.h>
 
 
 #define LOCTEXT_NAMESPACE "ImGuiEditor"
 
 #define SETTINGS_CONTAINER TEXT("Project"), TEXT("Plugins"), TEXT("ImGui")
 
+static const FName EditorTabName = "ImGuiEditor";
+
 
 namespace
 {
@@ -30,7 +40,8 @@ namespace
 	}
 }
 
-FImGuiEditor::FImGuiEditor()
+FImGuiEditor::FImGuiEditor(FImGuiModuleManager& InModuleManager)
+	: ModuleManager(InModuleManager)
 {
 	Register();
 
@@ -75,6 +86,17 @@ void FImGuiEditor::Register()
 				FOnGetPropertyTypeCustomizationInstance::CreateStatic(&FImGuiKeyInfoCustomization::MakeInstance));
 		}
 	}
+
+	// Tab widgets need Slate to create textures.
+	if (!bTabSpawnerRegistered && FSlateApplication::IsInitialized())
+	{
+		bTabSpawnerRegistered = true;
+
+		FGlobalTabmanager::Get()->RegisterNomadTabSpawner(EditorTabName, FOnSpawnTab::CreateRaw(this, &FImGuiEditor::SpawnEditorTab))
+			.SetDisplayName(LOCTEXT("ImGuiEditorTabTitle", "ImGui"))
+			.SetTooltipText(LOCTEXT("ImGuiEditorTabTooltip", "Open a tab with the editor ImGui context."))
+			.SetGroup(WorkspaceMenu::GetMenuStructure().GetDeveloperToolsMiscCategory());
+	}
 }
 
 void FImGuiEditor::Unregister()
@@ -99,6 +121,30 @@ void FImGuiEditor::Unregister()
 			PropertyModule->UnregisterCustomPropertyTypeLayout("ImGuiKeyInfo");
 		}
 	}
+
+	if (bTabSpawnerRegistered)
+	{
+		bTabSpawnerRegistered = false;
+
+		if (FSlateApplication::IsInitialized())
+		{
+			FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(EditorTabName);
+		}
+	}
+}
+
+TSharedRef<SDockTab> FImGuiEditor::SpawnEditorTab(const FSpawnTabArgs& Args)
+{
+	// Make sure that the editor context exists before the widget is created.
+	ModuleManager.GetContextManager().GetEditorContextProxy();
+
+	return SNew(SDockTab)
+		.TabRole(ETabRole::NomadTab)
+		[
+			SNew(SImGuiEditorWidget)
+			.ModuleManager(&ModuleManager)
+			.ContextIndex(Utilities::EDITOR_CONTEXT_INDEX)
+		];
 }
 
 void FImGuiEditor::CreateRegistrator()
@@ -5,19 +5,27 @@
 #if WITH_EDITOR
 
 #include <Delegates/IDelegateInstance.h>
+#include <Templates/SharedPointer.h>
 
 
-// Registers module's settings in editor (due to a small size of this code we don't use a separate editor module).
+class FImGuiModuleManager;
+class FSpawnTabArgs;
+class SDockTab;
+
+// Registers module's settings and tabs in editor (due to a small size of this code we don't use a separate editor
+// module).
 class FImGuiEditor
 {
 public:
 
-	FImGuiEditor();
+	FImGuiEditor(FImGuiModuleManager& InModuleManager);
 	~FImGuiEditor();
 
 private:
 
-	bool IsRegistrationCompleted() const { return bSettingsRegistered && bCustomPropertyTypeLayoutsRegistered; }
+	bool IsRegistrationCompleted() const { return bSettingsRegistered && bCustomPropertyTypeLayoutsRegistered && bTabSpawnerRegistered; }
+
+	TSharedRef<SDockTab> SpawnEditorTab(const FSpawnTabArgs& Args);
 
 	void Register();
 	void Unregister();
@@ -25,10 +33,13 @@ private:
 	void CreateRegistrator();
 	void ReleaseRegistrator();
 
+	FImGuiModuleManager& ModuleManager;
+
 	FDelegateHandle RegistratorHandle;
 
 	bool bSettingsRegistered = false;
 	bool bCustomPropertyTypeLayoutsRegistered = false;
+	bool bTabSpawnerRegistered = false;
 };
 
 #endif // WITH_EDITOR
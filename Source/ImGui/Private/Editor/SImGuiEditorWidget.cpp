@@ -0,0 +1,231 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "SImGuiEditorWidget.h"
+
+#if WITH_EDITOR
+
+#include "ImGuiContextManager.h"
+#include "ImGuiContextProxy.h"
+#include "ImGuiInputHandler.h"
+#include "ImGuiInputHandlerFactory.h"
+#include "ImGuiModuleManager.h"
+#include "ImGuiModuleSettings.h"
+#include "TextureManager.h"
+
+#include <Framework/Application/SlateApplication.h>
+#include <SlateOptMacros.h>
+
+
+BEGIN_SLATE_FUNCTION_BUILD_OPTIMIZATION
+void SImGuiEditorWidget::Construct(const FArguments& InArgs)
+{
+	checkf(InArgs._ModuleManager, TEXT("Null Module Manager argument"));
+
+	ModuleManager = InArgs._ModuleManager;
+	ContextIndex = InArgs._ContextIndex;
+
+	checkf(ModuleManager->GetContextManager().GetContextProxy(ContextIndex),
+		TEXT("Missing context during editor widget construction: ContextIndex = %d"), ContextIndex);
+
+	// Make sure that textures are loaded before the first paint.
+	ModuleManager->LoadTextures();
+
+	// Register to release buffers when memory is compacted.
+	ModuleManager->OnCompactMemory().AddRaw(this, &SImGuiEditorWidget::OnCompactMemory);
+
+	// Follow input handler changes.
+	auto& Settings = ModuleManager->GetSettings();
+	Settings.OnImGuiInputHandlerClassChanged.AddRaw(this, &SImGuiEditorWidget::CreateInputHandler);
+	CreateInputHandler(Settings.GetImGuiInputHandlerClass());
+
+	// Support Slate Global Invalidation.
+	ForceVolatile(true);
+}
+END_SLATE_FUNCTION_BUILD_OPTIMIZATION
+
+SImGuiEditorWidget::~SImGuiEditorWidget()
+{
+	ModuleManager->GetSettings().OnImGuiInputHandlerClassChanged.RemoveAll(this);
+	ModuleManager->OnCompactMemory().RemoveAll(this);
+
+	ReleaseInputHandler();
+}
+
+void SImGuiEditorWidget::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	Super::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	if (FImGuiContextProxy* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextIndex))
+	{
+		// Canvas follows the size of the tab.
+		ContextProxy->SetDisplaySize(AllottedGeometry.GetLocalSize());
+
+		// Widget is only ticked when it is visible, but the editor can still repaint in the background. We only request
+		// new frames when the editor is in the foreground, otherwise the context stays idle and we keep drawing the last
+		// output. Input that arrives in the meantime wakes the context on its own.
+		if (FSlateApplication::Get().IsActive())
+		{
+			ContextProxy->RequestFrame();
+		}
+	}
+}
+
+FReply SImGuiEditorWidget::OnKeyChar(const FGeometry& MyGeometry, const FCharacterEvent& CharacterEvent)
+{
+	return InputHandler.IsValid() ? InputHandler->OnKeyChar(CharacterEvent) : FReply::Unhandled();
+}
+
+FReply SImGuiEditorWidget::OnKeyDown(const FGeometry& MyGeometry, const FKeyEvent& KeyEvent)
+{
+	return InputHandler.IsValid() ? InputHandler->OnKeyDown(KeyEvent) : FReply::Unhandled();
+}
+
+FReply SImGuiEditorWidget::OnKeyUp(const FGeometry& MyGeometry, const FKeyEvent& KeyEvent)
+{
+	return InputHandler.IsValid() ? InputHandler->OnKeyUp(KeyEvent) : FReply::Unhandled();
+}
+
+FReply SImGuiEditorWidget::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (!InputHandler.IsValid())
+	{
+		return FReply::Unhandled();
+	}
+
+	// Take keyboard focus with a click, like other editor widgets.
+	return InputHandler->OnMouseButtonDown(MouseEvent).CaptureMouse(SharedThis(this)).SetUserFocus(SharedThis(this));
+}
+
+FReply SImGuiEditorWidget::OnMouseButtonDoubleClick(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	return InputHandler.IsValid() ? InputHandler->OnMouseButtonDoubleClick(MouseEvent).CaptureMouse(SharedThis(this)) : FReply::Unhandled();
+}
+
+FReply SImGuiEditorWidget::OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	if (!InputHandler.IsValid())
+	{
+		return FReply::Unhandled();
+	}
+
+	FReply Reply = InputHandler->OnMouseButtonUp(MouseEvent);
+	if (FSlateApplication::Get().GetPressedMouseButtons().Num() == 0)
+	{
+		Reply.ReleaseMouseCapture();
+	}
+	return Reply;
+}
+
+FReply SImGuiEditorWidget::OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	return InputHandler.IsValid() ? InputHandler->OnMouseWheel(MouseEvent) : FReply::Unhandled();
+}
+
+FReply SImGuiEditorWidget::OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	return InputHandler.IsValid()
+		? InputHandler->OnMouseMove(TransformScreenPointToImGui(MyGeometry, MouseEvent.GetScreenSpacePosition()), MouseEvent)
+		: FReply::Unhandled();
+}
+
+FReply SImGuiEditorWidget::OnFocusReceived(const FGeometry& MyGeometry, const FFocusEvent& FocusEvent)
+{
+	Super::OnFocusReceived(MyGeometry, FocusEvent);
+
+	if (InputHandler.IsValid())
+	{
+		InputHandler->OnKeyboardInputEnabled();
+		InputHandler->OnGamepadInputEnabled();
+	}
+
+	return FReply::Handled();
+}
+
+void SImGuiEditorWidget::OnFocusLost(const FFocusEvent& FocusEvent)
+{
+	Super::OnFocusLost(FocusEvent);
+
+	if (InputHandler.IsValid())
+	{
+		InputHandler->OnKeyboardInputDisabled();
+		InputHandler->OnGamepadInputDisabled();
+	}
+}
+
+void SImGuiEditorWidget::OnMouseEnter(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+	Super::OnMouseEnter(MyGeometry, MouseEvent);
+
+	if (InputHandler.IsValid())
+	{
+		InputHandler->OnMouseInputEnabled();
+	}
+}
+
+void SImGuiEditorWidget::OnMouseLeave(const FPointerEvent& MouseEvent)
+{
+	Super::OnMouseLeave(MouseEvent);
+
+	// While dragging, the mouse is captured and we still receive events from outside of the widget.
+	if (InputHandler.IsValid() && !HasMouseCapture())
+	{
+		InputHandler->OnMouseInputDisabled();
+	}
+}
+
+FCursorReply SImGuiEditorWidget::OnCursorQuery(const FGeometry& MyGeometry, const FPointerEvent& CursorEvent) const
+{
+	const FImGuiContextProxy* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextIndex);
+	return FCursorReply::Cursor(ContextProxy ? ContextProxy->GetMouseCursor() : EMouseCursor::Default);
+}
+
+void SImGuiEditorWidget::CreateInputHandler(const FSoftClassPath& HandlerClassReference)
+{
+	ReleaseInputHandler();
+
+	// There is no game viewport in editor tabs, so handlers need to work without it.
+	InputHandler = FImGuiInputHandlerFactory::NewHandler(HandlerClassReference, ModuleManager, nullptr, ContextIndex);
+}
+
+void SImGuiEditorWidget::ReleaseInputHandler()
+{
+	if (InputHandler.IsValid())
+	{
+		FImGuiInputHandlerFactory::ReleaseHandler(InputHandler.Get());
+		InputHandler.Reset();
+	}
+}
+
+void SImGuiEditorWidget::OnCompactMemory(int64& InOutReclaimedBytes)
+{
+	Painter.CompactMemory(InOutReclaimedBytes);
+}
+
+FVector2D SImGuiEditorWidget::TransformScreenPointToImGui(const FGeometry& MyGeometry, const FVector2D& Point) const
+{
+	return MyGeometry.GetAccumulatedRenderTransform().Inverse().TransformPoint(Point);
+}
+
+int32 SImGuiEditorWidget::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect,
+	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& WidgetStyle, bool bParentEnabled) const
+{
+	if (FImGuiContextProxy* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextIndex))
+	{
+		const FSlateRenderTransform& ImGuiToScreen = AllottedGeometry.GetAccumulatedRenderTransform();
+
+		// Editor DPI scale is applied in Slate.
+		ContextProxy->AddViewScale(ImGuiToScreen.TransformVector(FVector2D{ 1.f, 0.f }).Size(), AllottedGeometry.Scale);
+
+		Painter.Paint(*ContextProxy, ModuleManager->GetTextureManager(), ImGuiToScreen, MyClippingRect, OutDrawElements, LayerId,
+			ContextIndex);
+	}
+
+	return LayerId;
+}
+
+FVector2D SImGuiEditorWidget::ComputeDesiredSize(float) const
+{
+	return FVector2D(400.f, 300.f);
+}
+
+#endif // WITH_EDITOR
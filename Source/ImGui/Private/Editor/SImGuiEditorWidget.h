@@ -0,0 +1,92 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#if WITH_EDITOR
+
+#include "ImGuiSlatePainter.h"
+
+#include <Rendering/RenderingCommon.h>
+#include <UObject/WeakObjectPtr.h>
+#include <Widgets/DeclarativeSyntaxSupport.h>
+#include <Widgets/SLeafWidget.h>
+
+
+class FImGuiModuleManager;
+class UImGuiInputHandler;
+
+// Slate widget hosting an ImGui context in editor tabs. The context is ticked by the context manager like other contexts,
+// but it only renders in frames in which the widget requests it, meaning that the widget is visible and the editor is in
+// the foreground. Hidden or idle editor tabs don't spend time on rendering.
+class SImGuiEditorWidget : public SLeafWidget
+{
+	typedef SLeafWidget Super;
+
+public:
+
+	SLATE_BEGIN_ARGS(SImGuiEditorWidget)
+	{}
+	SLATE_ARGUMENT(FImGuiModuleManager*, ModuleManager)
+	SLATE_ARGUMENT(int32, ContextIndex)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	~SImGuiEditorWidget();
+
+	//----------------------------------------------------------------------------------------------------
+	// SWidget overrides
+	//----------------------------------------------------------------------------------------------------
+
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
+	virtual bool SupportsKeyboardFocus() const override { return true; }
+
+	virtual FReply OnKeyChar(const FGeometry& MyGeometry, const FCharacterEvent& CharacterEvent) override;
+
+	virtual FReply OnKeyDown(const FGeometry& MyGeometry, const FKeyEvent& KeyEvent) override;
+
+	virtual FReply OnKeyUp(const FGeometry& MyGeometry, const FKeyEvent& KeyEvent) override;
+
+	virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+
+	virtual FReply OnMouseButtonDoubleClick(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+
+	virtual FReply OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+
+	virtual FReply OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+
+	virtual FReply OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+
+	virtual FReply OnFocusReceived(const FGeometry& MyGeometry, const FFocusEvent& FocusEvent) override;
+
+	virtual void OnFocusLost(const FFocusEvent& FocusEvent) override;
+
+	virtual void OnMouseEnter(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+
+	virtual void OnMouseLeave(const FPointerEvent& MouseEvent) override;
+
+	virtual FCursorReply OnCursorQuery(const FGeometry& MyGeometry, const FPointerEvent& CursorEvent) const override;
+
+private:
+
+	void CreateInputHandler(const FSoftClassPath& HandlerClassReference);
+	void ReleaseInputHandler();
+
+	void OnCompactMemory(int64& InOutReclaimedBytes);
+
+	FVector2D TransformScreenPointToImGui(const FGeometry& MyGeometry, const FVector2D& Point) const;
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& WidgetStyle, bool bParentEnabled) const override;
+
+	virtual FVector2D ComputeDesiredSize(float) const override;
+
+	FImGuiModuleManager* ModuleManager = nullptr;
+	TWeakObjectPtr<UImGuiInputHandler> InputHandler;
+
+	mutable FImGuiSlatePainter Painter;
+
+	int32 ContextIndex = 0;
+};
+
+#endif // WITH_EDITOR
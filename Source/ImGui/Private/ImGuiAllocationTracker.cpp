@@ -0,0 +1,122 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiAllocationTracker.h"
+
+#include "ImGuiModuleDebug.h"
+
+#include <HAL/IConsoleManager.h>
+#include <HAL/PlatformStackWalk.h>
+
+#include <atomic>
+
+
+DEFINE_LOG_CATEGORY_STATIC(LogImGuiAllocations, Log, All);
+
+namespace CVars
+{
+	TAutoConsoleVariable<int> AllocationsTripwire(TEXT("ImGui.Allocations.Tripwire"), 0,
+		TEXT("Whether allocations made by ImGui and plugin containers after a warm-up should be logged with call sites.\n")
+		TEXT("Warm-up starts again every time this is enabled.\n")
+		TEXT("0: disabled (default)\n")
+		TEXT("1: enabled"),
+		ECVF_Default);
+
+	TAutoConsoleVariable<int> AllocationsWarmUpFrames(TEXT("ImGui.Allocations.WarmUpFrames"), 120,
+		TEXT("Number of frames after enabling the tripwire in which allocations are not logged."),
+		ECVF_Default);
+}
+
+namespace
+{
+	// Limit for reports logged in one frame (logging ImGui allocations walks the stack, which is slow).
+	constexpr int32 MaxReportsPerFrame = 4;
+
+	std::atomic<int32> FrameImGuiAllocations{ 0 };
+	std::atomic<int32> FrameContainerAllocations{ 0 };
+	std::atomic<int32> FrameReports{ 0 };
+	std::atomic<bool> bTripwireArmed{ false };
+
+	// Counts from the last closed frame and the warm-up state. Only accessed on the game thread.
+	int32 LastImGuiAllocations = 0;
+	int32 LastContainerAllocations = 0;
+	int32 WarmUpFrames = 0;
+	bool bTripwireEnabled = false;
+
+	bool ShouldReport()
+	{
+		return bTripwireArmed.load(std::memory_order_relaxed) && FrameReports.fetch_add(1, std::memory_order_relaxed) < MaxReportsPerFrame;
+	}
+}
+
+namespace ImGuiAllocationTracker
+{
+	void RecordImGuiAllocation(SIZE_T Size)
+	{
+		FrameImGuiAllocations.fetch_add(1, std::memory_order_relaxed);
+
+		if (UNLIKELY(ShouldReport()))
+		{
+			// Skip frames of this function and the ImGui allocator.
+			ANSICHAR StackTrace[8192];
+			StackTrace[0] = '\0';
+			FPlatformStackWalk::StackWalkAndDump(StackTrace, sizeof(StackTrace), 2);
+
+			UE_LOG(LogImGuiAllocations, Warning, TEXT("ImGui allocated %llu bytes after warm-up:\n%s"),
+				static_cast<uint64>(Size), ANSI_TO_TCHAR(StackTrace));
+		}
+	}
+
+	void RecordContainerAllocation(const ANSICHAR* File, int32 Line)
+	{
+		FrameContainerAllocations.fetch_add(1, std::memory_order_relaxed);
+
+		if (UNLIKELY(ShouldReport()))
+		{
+			UE_LOG(LogImGuiAllocations, Warning, TEXT("Container allocated after warm-up at %s(%d)."), ANSI_TO_TCHAR(File), Line);
+		}
+	}
+
+	void EndFrame()
+	{
+		LastImGuiAllocations = FrameImGuiAllocations.exchange(0, std::memory_order_relaxed);
+		LastContainerAllocations = FrameContainerAllocations.exchange(0, std::memory_order_relaxed);
+		FrameReports.store(0, std::memory_order_relaxed);
+
+		SET_DWORD_STAT(STAT_ImGuiAllocations, LastImGuiAllocations);
+		SET_DWORD_STAT(STAT_ImGuiContainerAllocations, LastContainerAllocations);
+
+		const bool bEnabled = CVars::AllocationsTripwire.GetValueOnGameThread() > 0;
+		if (bEnabled != bTripwireEnabled)
+		{
+			bTripwireEnabled = bEnabled;
+			WarmUpFrames = 0;
+		}
+
+		if (bTripwireEnabled && WarmUpFrames < MAX_int32)
+		{
+			WarmUpFrames++;
+		}
+
+		const bool bArmed = bTripwireEnabled && WarmUpFrames > CVars::AllocationsWarmUpFrames.GetValueOnGameThread();
+		if (bArmed && !bTripwireArmed.load(std::memory_order_relaxed))
+		{
+			UE_LOG(LogImGuiAllocations, Log, TEXT("Allocation tripwire armed."));
+		}
+		bTripwireArmed.store(bArmed, std::memory_order_relaxed);
+	}
+
+	int32 GetImGuiAllocations()
+	{
+		return LastImGuiAllocations;
+	}
+
+	int32 GetContainerAllocations()
+	{
+		return LastContainerAllocations;
+	}
+
+	bool IsTripwireArmed()
+	{
+		return bTripwireArmed.load(std::memory_order_relaxed);
+	}
+}
@@ -0,0 +1,77 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Templates/Decay.h>
+
+
+// Allocation tracking is compiled out from shipping builds.
+#define IMGUI_ALLOCATION_TRACKING !UE_BUILD_SHIPPING
+
+// Counts allocations made by the ImGui allocator and by plugin containers in every frame, to verify that a steady frame
+// doesn't allocate. With ImGui.Allocations.Tripwire enabled, allocations made after a warm-up are logged together with
+// their call sites (see ImGui.Allocations console variables).
+namespace ImGuiAllocationTracker
+{
+	// Record an allocation made by the ImGui allocator. Can be called from any thread.
+	// @param Size - Size of the allocation in bytes
+	void RecordImGuiAllocation(SIZE_T Size);
+
+	// Record growth of a plugin container. Can be called from any thread.
+	// @param File - Source file of the call site
+	// @param Line - Line of the call site
+	void RecordContainerAllocation(const ANSICHAR* File, int32 Line);
+
+	// Close the frame, update stats and advance the warm-up. Should be called on the game thread once per frame.
+	void EndFrame();
+
+	// Get the number of allocations made by ImGui and by plugin containers in the last frame.
+	int32 GetImGuiAllocations();
+	int32 GetContainerAllocations();
+
+	// Whether tripwire is enabled and has finished warming up.
+	bool IsTripwireArmed();
+}
+
+#if IMGUI_ALLOCATION_TRACKING
+
+// Records an allocation at the call site if the container grew while this object was in scope.
+template<typename TContainer>
+class TImGuiContainerGrowthScope
+{
+public:
+
+	TImGuiContainerGrowthScope(const TContainer& InContainer, const ANSICHAR* InFile, int32 InLine)
+		: Container(InContainer)
+		, AllocatedSize(InContainer.GetAllocatedSize())
+		, File(InFile)
+		, Line(InLine)
+	{
+	}
+
+	~TImGuiContainerGrowthScope()
+	{
+		if (Container.GetAllocatedSize() > AllocatedSize)
+		{
+			ImGuiAllocationTracker::RecordContainerAllocation(File, Line);
+		}
+	}
+
+private:
+
+	const TContainer& Container;
+	SIZE_T AllocatedSize;
+	const ANSICHAR* File;
+	int32 Line;
+};
+
+// Track growth of a container until the end of the current scope. Containers need to implement GetAllocatedSize.
+#define IMGUI_TRACK_CONTAINER_GROWTH(Container) \
+	const TImGuiContainerGrowthScope<typename TDecay<decltype(Container)>::Type> PREPROCESSOR_JOIN(ContainerGrowthScope, __LINE__)(Container, __FILE__, __LINE__)
+
+#else
+
+#define IMGUI_TRACK_CONTAINER_GROWTH(Container)
+
+#endif // IMGUI_ALLOCATION_TRACKING
@@ -0,0 +1,327 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiCommandPalette.h"
+
+#include "ImGuiModuleProperties.h"
+#include "Utilities/WorldContextIndex.h"
+
+#include <Engine/Engine.h>
+#include <HAL/IConsoleManager.h>
+
+#include <imgui_internal.h>
+
+
+namespace
+{
+	constexpr const char* WindowName = "Command Palette";
+
+	// Results beyond this limit are still counted but not ranked.
+	constexpr int32 MaxResults = 200;
+
+	UWorld* FindWorld(int32 ContextIndex)
+	{
+		if (GEngine)
+		{
+			for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+			{
+				if (Utilities::GetWorldContextIndex(WorldContext) == ContextIndex)
+				{
+					return WorldContext.World();
+				}
+			}
+		}
+
+		return GWorld;
+	}
+
+	IConsoleObject* FindConsoleObject(const char* Name)
+	{
+		return IConsoleManager::Get().FindConsoleObject(UTF8_TO_TCHAR(Name));
+	}
+}
+
+void FImGuiCommandPalette::DrawControls(int32 ContextIndex)
+{
+	UpdateInput();
+
+	FContextState& State = Contexts.FindOrAdd(ContextIndex);
+	if (Properties.ShowCommandPalette() != State.bOpen)
+	{
+		State.bOpen = Properties.ShowCommandPalette();
+		if (State.bOpen)
+		{
+			IndexConsoleObjects(State);
+
+			State.QueryBuffer[0] = '\0';
+			State.SelectedResult = 0;
+		}
+	}
+
+	if (State.bOpen)
+	{
+		IndexWindows(State);
+
+		const ImGuiViewport* Viewport = ImGui::GetMainViewport();
+		ImGui::SetNextWindowPos(ImVec2(Viewport->WorkPos.x + Viewport->WorkSize.x * 0.5f, Viewport->WorkPos.y + Viewport->WorkSize.y * 0.15f),
+			ImGuiCond_Appearing, ImVec2(0.5f, 0.f));
+		ImGui::SetNextWindowSize(ImVec2(600, 400), ImGuiCond_FirstUseEver);
+
+		bool bWindowOpen = true;
+		if (ImGui::Begin(WindowName, &bWindowOpen, ImGuiWindowFlags_NoCollapse))
+		{
+			if (ImGui::IsWindowAppearing())
+			{
+				ImGui::SetKeyboardFocusHere();
+			}
+
+			const char* QueryBuffer = State.QueryBuffer;
+
+			ImGui::SetNextItemWidth(-FLT_MIN);
+			const bool bEnter = ImGui::InputTextWithHint("##Query", "Windows, commands and variables (arguments after a space)",
+				State.QueryBuffer, IM_ARRAYSIZE(State.QueryBuffer), ImGuiInputTextFlags_EnterReturnsTrue);
+
+			// Query is the text before the first space and the rest are arguments.
+			char Query[IM_ARRAYSIZE(State.QueryBuffer)];
+			int32 QueryLength = 0;
+			while (QueryBuffer[QueryLength] != '\0' && QueryBuffer[QueryLength] != ' ')
+			{
+				Query[QueryLength] = QueryBuffer[QueryLength];
+				QueryLength++;
+			}
+			Query[QueryLength] = '\0';
+
+			const char* Arguments = QueryBuffer + QueryLength;
+			while (*Arguments == ' ')
+			{
+				Arguments++;
+			}
+
+			UpdateResults(State, Query);
+
+			if (ImGui::IsWindowFocused(ImGuiFocusedFlags_RootAndChildWindows) && State.Results.Num() > 0)
+			{
+				if (ImGui::IsKeyPressed(ImGuiKey_DownArrow))
+				{
+					State.SelectedResult = FMath::Min(State.SelectedResult + 1, State.Results.Num() - 1);
+					State.bScrollToSelected = true;
+				}
+				else if (ImGui::IsKeyPressed(ImGuiKey_UpArrow))
+				{
+					State.SelectedResult = FMath::Max(State.SelectedResult - 1, 0);
+					State.bScrollToSelected = true;
+				}
+			}
+
+			ImGui::TextDisabled("%d matches in %d entries (%.3f ms)", State.Matches.Num(), State.Index.Num(), State.SearchTime * 1000.0);
+
+			int32 ExecutedResult = DrawResults(State);
+			if (bEnter && State.Results.IsValidIndex(State.SelectedResult))
+			{
+				ExecutedResult = State.SelectedResult;
+			}
+
+			if (ExecutedResult != INDEX_NONE)
+			{
+				Execute(State, State.Results[ExecutedResult], Arguments, ContextIndex);
+				bWindowOpen = false;
+			}
+			else if (ImGui::IsWindowFocused(ImGuiFocusedFlags_RootAndChildWindows) && ImGui::IsKeyPressed(ImGuiKey_Escape))
+			{
+				bWindowOpen = false;
+			}
+		}
+		ImGui::End();
+
+		if (!bWindowOpen)
+		{
+			Properties.SetShowCommandPalette(false);
+		}
+	}
+}
+
+void FImGuiCommandPalette::UpdateInput()
+{
+	if (Properties.ShowCommandPalette() != bWasOpen)
+	{
+		bWasOpen = Properties.ShowCommandPalette();
+		if (bWasOpen)
+		{
+			// Palette needs input, so we enable it until the palette is closed.
+			bRestoreInput = !Properties.IsInputEnabled();
+			Properties.SetInputEnabled(true);
+		}
+		else if (bRestoreInput)
+		{
+			Properties.SetInputEnabled(false);
+			bRestoreInput = false;
+		}
+	}
+	else if (bWasOpen && bRestoreInput && !Properties.IsInputEnabled())
+	{
+		// Input was disabled while the palette was open, so the state before opening is not ours to restore anymore.
+		bRestoreInput = false;
+	}
+}
+
+void FImGuiCommandPalette::IndexConsoleObjects(FContextState& State)
+{
+	// Only objects registered since the last time are added.
+	IConsoleManager::Get().ForEachConsoleObjectThatStartsWith(FConsoleObjectVisitor::CreateLambda(
+		[&State](const TCHAR* Name, IConsoleObject* Object)
+		{
+			if (Object && !Object->TestFlags(ECVF_Unregistered))
+			{
+				bool bAlreadyIndexed = false;
+				State.IndexedConsoleObjects.Add(Name, &bAlreadyIndexed);
+				if (!bAlreadyIndexed)
+				{
+					State.Index.Add(TCHAR_TO_UTF8(Name));
+					State.Entries.Add({ Object->AsCommand() ? EEntryType::Command : EEntryType::Variable, 0 });
+				}
+			}
+		}));
+}
+
+void FImGuiCommandPalette::IndexWindows(FContextState& State)
+{
+	constexpr ImGuiWindowFlags SkippedWindows = ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_Tooltip | ImGuiWindowFlags_Popup;
+
+	for (const ImGuiWindow* Window : GImGui->Windows)
+	{
+		if ((Window->Flags & SkippedWindows) == 0 && !Window->IsFallbackWindow)
+		{
+			bool bAlreadyIndexed = false;
+			State.IndexedWindows.Add(Window->ID, &bAlreadyIndexed);
+
+			// Index the visible part of the name (without the '##' suffix).
+			const char* NameEnd = ImGui::FindRenderedTextEnd(Window->Name);
+			if (!bAlreadyIndexed && NameEnd != Window->Name && FCStringAnsi::Strcmp(Window->Name, WindowName) != 0)
+			{
+				State.Index.Add(Window->Name, static_cast<int32>(NameEnd - Window->Name));
+				State.Entries.Add({ EEntryType::Window, Window->ID });
+			}
+		}
+	}
+}
+
+void FImGuiCommandPalette::UpdateResults(FContextState& State, const char* Query)
+{
+	const bool bIndexChanged = (State.NumIndexedEntries != State.Index.Num());
+	const bool bQueryChanged = (State.ResultsQuery.Num() == 0 || FCStringAnsi::Strcmp(State.ResultsQuery.GetData(), Query) != 0);
+	if (!bIndexChanged && !bQueryChanged)
+	{
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// If the index didn't change, matches of a query are the only candidates for queries that extend it.
+	const int32 PreviousLength = State.ResultsQuery.Num() - 1;
+	const bool bNarrow = !bIndexChanged && PreviousLength > 0 && FCStringAnsi::Strncmp(Query, State.ResultsQuery.GetData(), PreviousLength) == 0;
+
+	State.Index.Search(Query, bNarrow ? &State.Matches : nullptr, State.MatchesBuffer, MaxResults, State.Results);
+	Swap(State.Matches, State.MatchesBuffer);
+
+	State.ResultsQuery.Reset();
+	State.ResultsQuery.Append(Query, FCStringAnsi::Strlen(Query) + 1);
+	State.NumIndexedEntries = State.Index.Num();
+
+	State.SearchTime = FPlatformTime::Seconds() - StartTime;
+
+	if (bQueryChanged)
+	{
+		State.SelectedResult = 0;
+	}
+	else
+	{
+		State.SelectedResult = FMath::Clamp(State.SelectedResult, 0, FMath::Max(State.Results.Num() - 1, 0));
+	}
+}
+
+int32 FImGuiCommandPalette::DrawResults(FContextState& State)
+{
+	int32 ClickedResult = INDEX_NONE;
+
+	if (ImGui::BeginChild("Results"))
+	{
+		// Only visible results are drawn, plus the selected one if we need to scroll to it.
+		ImGuiListClipper Clipper;
+		Clipper.Begin(State.Results.Num(), ImGui::GetTextLineHeightWithSpacing());
+		if (State.bScrollToSelected && State.Results.IsValidIndex(State.SelectedResult))
+		{
+			Clipper.IncludeItemByIndex(State.SelectedResult);
+		}
+
+		while (Clipper.Step())
+		{
+			for (int32 Row = Clipper.DisplayStart; Row < Clipper.DisplayEnd; Row++)
+			{
+				const int32 Entry = State.Results[Row];
+				const char* Name = State.Index.GetName(Entry);
+
+				ImGui::PushID(Row);
+
+				if (ImGui::Selectable(Name, Row == State.SelectedResult))
+				{
+					ClickedResult = Row;
+				}
+
+				if (Row == State.SelectedResult && State.bScrollToSelected)
+				{
+					ImGui::SetScrollHereY();
+					State.bScrollToSelected = false;
+				}
+
+				IConsoleObject* Object = (State.Entries[Entry].Type != EEntryType::Window) ? FindConsoleObject(Name) : nullptr;
+				if (Object && ImGui::IsItemHovered(ImGuiHoveredFlags_DelayNormal))
+				{
+					ImGui::SetTooltip("%s", TCHAR_TO_UTF8(Object->GetHelp()));
+				}
+
+				// Type of the entry and for variables, their values, aligned to the right.
+				FString Details;
+				switch (State.Entries[Entry].Type)
+				{
+				case EEntryType::Window: Details = TEXT("window"); break;
+				case EEntryType::Command: Details = TEXT("command"); break;
+				case EEntryType::Variable:
+					Details = (Object && Object->AsVariable()) ? FString::Printf(TEXT("= %s"), *Object->AsVariable()->GetString()) : TEXT("variable");
+					break;
+				}
+
+				const FTCHARToUTF8 DetailsUTF8(*Details);
+				const char* DetailsText = DetailsUTF8.Get();
+				ImGui::SameLine(FMath::Max(ImGui::GetContentRegionMax().x - ImGui::CalcTextSize(DetailsText).x, 0.f));
+				ImGui::TextDisabled("%s", DetailsText);
+
+				ImGui::PopID();
+			}
+		}
+	}
+	ImGui::EndChild();
+
+	return ClickedResult;
+}
+
+void FImGuiCommandPalette::Execute(const FContextState& State, int32 Entry, const char* Arguments, int32 ContextIndex)
+{
+	if (State.Entries[Entry].Type == EEntryType::Window)
+	{
+		if (ImGuiWindow* Window = ImGui::FindWindowByID(State.Entries[Entry].WindowId))
+		{
+			ImGui::SetWindowCollapsed(Window, false);
+			ImGui::FocusWindow(Window);
+		}
+	}
+	else if (GEngine)
+	{
+		FString Command = UTF8_TO_TCHAR(State.Index.GetName(Entry));
+		if (*Arguments)
+		{
+			Command += TEXT(" ");
+			Command += UTF8_TO_TCHAR(Arguments);
+		}
+
+		GEngine->Exec(FindWorld(ContextIndex), *Command);
+	}
+}
@@ -0,0 +1,96 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "ImGuiFuzzyIndex.h"
+
+#include <CoreMinimal.h>
+
+#include <imgui.h>
+
+class FImGuiModuleProperties;
+
+// Widget drawing a command palette that finds ImGui windows (including panels registered with FImGuiDelegates),
+// console commands and console variables with fuzzy matching. Selecting a window focuses it and selecting a console
+// object executes it with arguments typed after the first space. Names are added to the index incrementally: console
+// objects when the palette opens and windows every frame while it is open. Palette is drawn in every context, but
+// each context has its own index, query and results, so windows are only found and focused in their own contexts.
+class FImGuiCommandPalette
+{
+public:
+
+	FImGuiCommandPalette(FImGuiModuleProperties& InProperties)
+		: Properties(InProperties)
+	{
+	}
+
+	void DrawControls(int32 ContextIndex);
+
+	// Release state of a context (should be called when the context is created, as indices can be reused).
+	void ResetContext(int32 ContextIndex) { Contexts.Remove(ContextIndex); }
+
+private:
+
+	enum class EEntryType : uint8
+	{
+		Window,
+		Command,
+		Variable
+	};
+
+	struct FEntry
+	{
+		EEntryType Type;
+		ImGuiID WindowId;
+	};
+
+	// State of the palette in one context.
+	struct FContextState
+	{
+		FImGuiFuzzyIndex Index;
+
+		// Data of entries in the index.
+		TArray<FEntry> Entries;
+
+		// Names that are already indexed.
+		TSet<FString> IndexedConsoleObjects;
+		TSet<ImGuiID> IndexedWindows;
+
+		// Query of the current results and all matches of that query, which are candidates for queries that extend it.
+		TArray<char> ResultsQuery;
+		TArray<int32> Matches;
+		TArray<int32> MatchesBuffer;
+		TArray<int32> Results;
+		int32 NumIndexedEntries = INDEX_NONE;
+
+		double SearchTime = 0.0;
+
+		int32 SelectedResult = 0;
+		bool bScrollToSelected = false;
+
+		char QueryBuffer[256] = {};
+
+		bool bOpen = false;
+	};
+
+	// Enable input while the palette is open and restore the previous state after it is closed.
+	void UpdateInput();
+
+	static void IndexConsoleObjects(FContextState& State);
+	static void IndexWindows(FContextState& State);
+
+	static void UpdateResults(FContextState& State, const char* Query);
+
+	// Draw results and get the index of the clicked result or INDEX_NONE.
+	static int32 DrawResults(FContextState& State);
+
+	static void Execute(const FContextState& State, int32 Entry, const char* Arguments, int32 ContextIndex);
+
+	FImGuiModuleProperties& Properties;
+
+	TMap<int32, FContextState> Contexts;
+
+	// Input state is shared by all contexts, so it is handled once for all of them.
+	bool bWasOpen = false;
+	bool bRestoreInput = false;
+};
@@ -3,11 +3,14 @@
 #include "ImGuiContextManager.h"
 
 #include "ImGuiDelegatesContainer.h"
+#include "ImGuiImplementation.h"
 #include "ImGuiModuleSettings.h"
 #include "ImGuiModule.h"
 #include "Utilities/WorldContext.h"
 #include "Utilities/WorldContextIndex.h"
 
+#include <Async/Async.h>
+
 #include <imgui.h>
 
 
@@ -23,6 +26,12 @@ namespace
 		return TEXT("Editor");
 	}
 
+	// Name for ImGui context shared by PIE instances.
+	FORCEINLINE FString GetSharedPIEContextName()
+	{
+		return TEXT("PIEShared");
+	}
+
 	// Name for world ImGui context.
 	FORCEINLINE FString GetWorldContextName(const UWorld& World)
 	{
@@ -55,6 +64,61 @@ namespace
 	}
 
 #endif // WITH_EDITOR
+
+	// Get configurations of custom fonts that should be in the font atlas. Lazy fonts are skipped until requested.
+	TArray<TPair<FName, ImFontConfig>> GetCustomFontConfigs(const TSet<FName>& RequestedLazyFonts)
+	{
+		const FImGuiModuleProperties& Properties = FImGuiModule::Get().GetProperties();
+
+		TArray<TPair<FName, ImFontConfig>> CustomFontConfigs;
+		for (const TPair<FName, TSharedPtr<ImFontConfig>>& CustomFontPair : Properties.GetCustomFonts())
+		{
+			const FName CustomFontName = CustomFontPair.Key;
+			if (CustomFontPair.Value.IsValid()
+				&& (!Properties.IsCustomFontLazy(CustomFontName) || RequestedLazyFonts.Contains(CustomFontName)))
+			{
+				ImFontConfig& CustomFontConfig = CustomFontConfigs.Emplace_GetRef(CustomFontName, *CustomFontPair.Value).Value;
+
+				// Set font name for debugging
+				FCStringAnsi::Strncpy(CustomFontConfig.Name, TCHAR_TO_ANSI(*CustomFontName.ToString()), sizeof(CustomFontConfig.Name));
+
+				// Atlases are rebuilt from the same configuration, so each of them needs its own copy of the font data.
+				CustomFontConfig.FontDataOwnedByAtlas = false;
+			}
+		}
+		return CustomFontConfigs;
+	}
+
+	// Add the default font and custom fonts to the atlas and build it. This doesn't need a context, so it can be done
+	// on any thread.
+	// @returns Indices of custom fonts in the atlas
+	TMap<FName, int32> AddFonts(ImFontAtlas& FontAtlas, float DPIScale, const TArray<TPair<FName, ImFontConfig>>& CustomFontConfigs)
+	{
+		ImFontConfig FontConfig = {};
+		FontConfig.SizePixels = FMath::RoundFromZero(13.f * DPIScale);
+		FontAtlas.AddFontDefault(&FontConfig);
+
+
+		// auto path = FPaths::ProjectContentDir() / "UI" / "Fonts"
+		// 	/ "hf-free-complete" / "compass-pro-v1.1" / "CompassPro.ttf";
+		// FontAtlas.AddFontFromFileTTF(TCHAR_TO_ANSI(*path), 15);
+
+		// Build custom fonts
+		TMap<FName, int32> FontIndices;
+		for (const TPair<FName, ImFontConfig>& CustomFontPair : CustomFontConfigs)
+		{
+			FontAtlas.AddFont(&CustomFontPair.Value);
+
+			// Fonts in merge mode are added to the last font, so in both cases it is the one to use.
+			FontIndices.Add(CustomFontPair.Key, FontAtlas.Fonts.Size - 1);
+		}
+
+		unsigned char* Pixels;
+		int Width, Height, Bpp;
+		FontAtlas.GetTexDataAsRGBA32(&Pixels, &Width, &Height, &Bpp);
+
+		return FontIndices;
+	}
 }
 
 FImGuiContextManager::FImGuiContextManager(FImGuiModuleSettings& InSettings)
@@ -64,28 +128,42 @@ FImGuiContextManager::FImGuiContextManager(FImGuiModuleSettings& InSettings)
 
 	SetDPIScale(Settings.GetDPIScaleInfo());
 
+	Settings.OnMemoryCompactTimerChanged.AddRaw(this, &FImGuiContextManager::SetMemoryCompactTimers);
+
+	// Apply settings to new contexts before other listeners are notified.
+	OnContextProxyCreated.AddRaw(this, &FImGuiContextManager::InitializeContextProxy);
+
 	BuildFontAtlas();
 
 	FWorldDelegates::OnWorldTickStart.AddRaw(this, &FImGuiContextManager::OnWorldTickStart);
 #if ENGINE_COMPATIBILITY_WITH_WORLD_POST_ACTOR_TICK
 	FWorldDelegates::OnWorldPostActorTick.AddRaw(this, &FImGuiContextManager::OnWorldPostActorTick);
 #endif
+#if WITH_EDITOR
+	FWorldDelegates::OnWorldCleanup.AddRaw(this, &FImGuiContextManager::OnWorldCleanup);
+#endif
 }
 
 FImGuiContextManager::~FImGuiContextManager()
 {
+	CancelLazyFonts();
+
 	for(auto & p : Contexts)
 	{
 		// needed to unlock ImFontAtlas in order to free them without errors
 		p.Value.ContextProxy->EndFrame();
 	}
 	Settings.OnDPIScaleChangedDelegate.RemoveAll(this);
+	Settings.OnMemoryCompactTimerChanged.RemoveAll(this);
 
 	// Order matters because contexts can be created during World Tick Start events.
 	FWorldDelegates::OnWorldTickStart.RemoveAll(this);
 #if ENGINE_COMPATIBILITY_WITH_WORLD_POST_ACTOR_TICK
 	FWorldDelegates::OnWorldPostActorTick.RemoveAll(this);
 #endif
+#if WITH_EDITOR
+	FWorldDelegates::OnWorldCleanup.RemoveAll(this);
+#endif
 }
 
 void FImGuiContextManager::Tick(float DeltaSeconds)
@@ -98,12 +176,22 @@ void FImGuiContextManager::Tick(float DeltaSeconds)
 		auto& ContextData = Pair.Value;
 		if (ContextData.CanTick())
 		{
+			// Contexts that tick on demand need to rebind to new fonts before old resources are released.
+			if (FontResourcesReleaseCountdown > 0)
+			{
+				ContextData.ContextProxy->RequestFrame();
+			}
+
 			ContextData.ContextProxy->Tick(DeltaSeconds);
 		}
 		else
 		{
 			// Clear to make sure that we don't store objects registered for world that is no longer valid.
 			FImGuiDelegatesContainer::Get().OnWorldDebug(Pair.Key).Clear();
+			for (int32 WorldIndex : ContextData.ContextProxy->GetSharedWorlds())
+			{
+				FImGuiDelegatesContainer::Get().OnWorldDebug(WorldIndex).Clear();
+			}
 		}
 	}
 
@@ -113,6 +201,9 @@ void FImGuiContextManager::Tick(float DeltaSeconds)
 	{
 		FontResourcesToRelease.Empty();
 	}
+
+	// Swap in lazy fonts built in the background or start building newly requested ones.
+	UpdateLazyFonts();
 }
 
 #if ENGINE_COMPATIBILITY_LEGACY_WORLD_ACTOR_TICK
@@ -151,6 +242,21 @@ void FImGuiContextManager::OnWorldPostActorTick(UWorld* World, ELevelTick TickTy
 #endif // ENGINE_COMPATIBILITY_WITH_WORLD_POST_ACTOR_TICK
 
 #if WITH_EDITOR
+void FImGuiContextManager::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	if (World && World->WorldType == EWorldType::PIE)
+	{
+		FContextData* SharedData = Contexts.Find(Utilities::SHARED_PIE_CONTEXT_INDEX);
+		const FWorldContext* WorldContext = GEngine->GetWorldContextFromWorld(World);
+		if (SharedData && WorldContext)
+		{
+			// Stop broadcasting events of the torn down world and using input of its view.
+			SharedData->ContextProxy->RemoveSharedWorld(WorldContext->PIEInstance);
+			FImGuiDelegatesContainer::Get().OnWorldDebug(WorldContext->PIEInstance).Clear();
+		}
+	}
+}
+
 FImGuiContextManager::FContextData& FImGuiContextManager::GetEditorContextData()
 {
 	FContextData* Data = Contexts.Find(Utilities::EDITOR_CONTEXT_INDEX);
@@ -158,11 +264,32 @@ FImGuiContextManager::FContextData& FImGuiContextManager::GetEditorContextData()
 	if (UNLIKELY(!Data))
 	{
 		Data = &Contexts.Emplace(Utilities::EDITOR_CONTEXT_INDEX, FContextData{ GetEditorContextName(), Utilities::EDITOR_CONTEXT_INDEX, FontAtlas, DPIScale, -1 });
+
+		// Editor context is only displayed in editor tabs, so it only ticks in frames in which they request it.
+		Data->ContextProxy->SetTickOnDemand(true);
+
 		OnContextProxyCreated.Broadcast(Utilities::EDITOR_CONTEXT_INDEX, *Data->ContextProxy);
 	}
 
 	return *Data;
 }
+
+FImGuiContextManager::FContextData& FImGuiContextManager::GetSharedPIEContextData()
+{
+	FContextData* Data = Contexts.Find(Utilities::SHARED_PIE_CONTEXT_INDEX);
+
+	if (UNLIKELY(!Data))
+	{
+		Data = &Contexts.Emplace(Utilities::SHARED_PIE_CONTEXT_INDEX, FContextData{ GetSharedPIEContextName(), Utilities::SHARED_PIE_CONTEXT_INDEX, FontAtlas, DPIScale });
+
+		// Any of the sharing worlds keeps this context alive.
+		Data->bIsSharedByWorlds = true;
+
+		OnContextProxyCreated.Broadcast(Utilities::SHARED_PIE_CONTEXT_INDEX, *Data->ContextProxy);
+	}
+
+	return *Data;
+}
 #endif // WITH_EDITOR
 
 #if !WITH_EDITOR
@@ -209,6 +336,21 @@ FImGuiContextManager::FContextData& FImGuiContextManager::GetWorldContextData(co
 		Index, *World.GetName(), static_cast<int32>(World.WorldType), static_cast<int32>(World.GetNetMode()));
 #endif
 
+#if WITH_EDITOR
+	// Route all PIE instances to one context, which will broadcast their world events.
+	if (WorldContext->WorldType == EWorldType::PIE && Settings.ShouldSharePIEContexts())
+	{
+		FContextData& SharedData = GetSharedPIEContextData();
+		SharedData.ContextProxy->AddSharedWorld(Index);
+
+		if (OutIndex)
+		{
+			*OutIndex = SHARED_PIE_CONTEXT_INDEX;
+		}
+		return SharedData;
+	}
+#endif
+
 	FContextData* Data = Contexts.Find(Index);
 
 #if WITH_EDITOR
@@ -260,54 +402,158 @@ void FImGuiContextManager::SetDPIScale(const FImGuiDPIScaleInfo& ScaleInfo)
 	}
 }
 
-void FImGuiContextManager::BuildFontAtlas(const TMap<FName, TSharedPtr<ImFontConfig>>& CustomFontConfigs)
+void FImGuiContextManager::SetMemoryCompactTimers()
 {
-	if (!FontAtlas.IsBuilt())
+	for (auto& Pair : Contexts)
 	{
-		ImFontConfig FontConfig = {};
-		FontConfig.SizePixels = FMath::RoundFromZero(13.f * DPIScale);
-		FontAtlas.AddFontDefault(&FontConfig);
-
+		if (Pair.Value.ContextProxy)
+		{
+			InitializeContextProxy(Pair.Key, *Pair.Value.ContextProxy);
+		}
+	}
+}
 
-		// auto path = FPaths::ProjectContentDir() / "UI" / "Fonts"
-		// 	/ "hf-free-complete" / "compass-pro-v1.1" / "CompassPro.ttf";
-		// FontAtlas.AddFontFromFileTTF(TCHAR_TO_ANSI(*path), 15);
+void FImGuiContextManager::InitializeContextProxy(int32 ContextIndex, FImGuiContextProxy& ContextProxy)
+{
+	ContextProxy.SetMemoryCompactTimer(Settings.GetMemoryCompactTimer(ContextProxy.GetName()));
+}
 
-		// Build custom fonts
-		for (const TPair<FName, TSharedPtr<ImFontConfig>>& CustomFontPair : CustomFontConfigs)
+void FImGuiContextManager::CompactMemory()
+{
+	for (auto& Pair : Contexts)
+	{
+		if (Pair.Value.ContextProxy)
 		{
-			FName CustomFontName = CustomFontPair.Key;
-			TSharedPtr<ImFontConfig> CustomFontConfig = CustomFontPair.Value;
-
-			// Set font name for debugging
-			if (CustomFontConfig.IsValid())
-			{
-				strcpy_s(CustomFontConfig->Name, 40, TCHAR_TO_ANSI(*CustomFontName.ToString()));
-			}
-		
-			FontAtlas.AddFont(CustomFontConfig.Get());
+			Pair.Value.ContextProxy->CompactMemory();
 		}
+	}
+}
 
-		unsigned char* Pixels;
-		int Width, Height, Bpp;
-		FontAtlas.GetTexDataAsRGBA32(&Pixels, &Width, &Height, &Bpp);
+void FImGuiContextManager::BuildFontAtlas(const TArray<TPair<FName, ImFontConfig>>& CustomFontConfigs)
+{
+	if (!FontAtlas.IsBuilt())
+	{
+		FontIndices = AddFonts(FontAtlas, DPIScale, CustomFontConfigs);
 
 		OnFontAtlasBuilt.Broadcast();
 	}
 }
 
 void FImGuiContextManager::RebuildFontAtlas()
+{
+	// Requested lazy fonts are added to the rebuilt atlas, so there is no need for the background build.
+	CancelLazyFonts();
+	bLazyFontsPending = false;
+
+	RetireFontAtlas();
+
+	BuildFontAtlas(GetCustomFontConfigs(RequestedLazyFonts));
+}
+
+ImFont* FImGuiContextManager::GetFont(FName FontName)
+{
+	checkf(IsInGameThread(), TEXT("Fonts can only be requested on the game thread."));
+
+	if (const int32* Index = FontIndices.Find(FontName))
+	{
+		return FontAtlas.Fonts[*Index];
+	}
+
+	if (!RequestedLazyFonts.Contains(FontName))
+	{
+		const FImGuiModuleProperties& Properties = FImGuiModule::Get().GetProperties();
+		if (Properties.IsCustomFontLazy(FontName) && Properties.GetCustomFonts().Contains(FontName))
+		{
+			RequestedLazyFonts.Add(FontName);
+			bLazyFontsPending = true;
+		}
+	}
+
+	return (FontAtlas.Fonts.Size > 0) ? FontAtlas.Fonts[0] : nullptr;
+}
+
+void FImGuiContextManager::RetireFontAtlas()
 {
 	if (FontAtlas.IsBuilt())
 	{
+		// Parallel panels might still be reading from the atlas.
+		for (auto& Pair : Contexts)
+		{
+			if (Pair.Value.ContextProxy)
+			{
+				Pair.Value.ContextProxy->WaitForParallelPanels();
+			}
+		}
+
 		// Keep the old resources alive for a few frames to give all contexts a chance to bind to new ones.
 		FontResourcesToRelease.Add(TUniquePtr<ImFontAtlas>(new ImFontAtlas()));
 		Swap(*FontResourcesToRelease.Last(), FontAtlas);
 
+		// Contexts lock the atlas for the duration of their frames, but the retired one will not be used in new frames
+		// and needs to be unlocked to be released.
+		FontResourcesToRelease.Last()->Locked = false;
+
 		// Typically, one frame should be enough but since we allow for custom ticking, we need at least to frames to
 		// wait for contexts that already ticked and will not do that before the end of the next tick of this manager.
 		FontResourcesReleaseCountdown = 3;
 	}
+}
+
+void FImGuiContextManager::UpdateLazyFonts()
+{
+	if (LazyFontAtlasTask.IsValid())
+	{
+		if (!LazyFontAtlasTask.IsReady())
+		{
+			return;
+		}
+		LazyFontAtlasTask.Reset();
+
+		// Replace the current atlas with the one built in the background.
+		RetireFontAtlas();
+		Swap(FontAtlas, *LazyFontAtlas);
+		LazyFontAtlas.Reset();
 
-	BuildFontAtlas(FImGuiModule::Get().GetProperties().GetCustomFonts());
+		// Fonts keep a pointer to their atlas, which has just been moved.
+		for (ImFont* Font : FontAtlas.Fonts)
+		{
+			Font->ContainerAtlas = &FontAtlas;
+		}
+
+		FontIndices = MoveTemp(LazyFontIndices);
+
+		OnFontAtlasBuilt.Broadcast();
+	}
+
+	if (bLazyFontsPending && FontAtlas.IsBuilt())
+	{
+		bLazyFontsPending = false;
+		BuildLazyFontsAsync();
+	}
+}
+
+void FImGuiContextManager::BuildLazyFontsAsync()
+{
+	// Build a complete atlas with all requested fonts, so it can replace the current one in a single step.
+	LazyFontAtlas = MakeUnique<ImFontAtlas>();
+
+	ImFontAtlas* Atlas = LazyFontAtlas.Get();
+	TMap<FName, int32>* Indices = &LazyFontIndices;
+	LazyFontAtlasTask = Async(EAsyncExecution::ThreadPool,
+		[Atlas, Indices, Scale = DPIScale, CustomFontConfigs = GetCustomFontConfigs(RequestedLazyFonts)]()
+		{
+			ImGuiImplementation::DetachThreadContext();
+			*Indices = AddFonts(*Atlas, Scale, CustomFontConfigs);
+			ImGuiImplementation::SetThreadContext(nullptr);
+		});
+}
+
+void FImGuiContextManager::CancelLazyFonts()
+{
+	if (LazyFontAtlasTask.IsValid())
+	{
+		LazyFontAtlasTask.Wait();
+		LazyFontAtlasTask.Reset();
+		LazyFontAtlas.Reset();
+	}
 }
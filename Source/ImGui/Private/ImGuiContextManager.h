@@ -5,6 +5,8 @@
 #include "ImGuiContextProxy.h"
 #include "VersionCompatibility.h"
 
+#include <Async/Future.h>
+
 
 class FImGuiModuleSettings;
 struct FImGuiDPIScaleInfo;
@@ -68,6 +70,13 @@ public:
 
 	void RebuildFontAtlas();
 
+	// Get a font by name or the default font if it is not in the font atlas. Lazy custom fonts that are not in the atlas
+	// are requested and added to it in the background. Can only be called on the game thread.
+	ImFont* GetFont(FName FontName);
+
+	// Immediately release transient buffers in all contexts.
+	void CompactMemory();
+
 private:
 
 	struct FContextData
@@ -78,9 +87,22 @@ private:
 		{
 		}
 
-		FORCEINLINE bool CanTick() const { return PIEInstance < 0 || GEngine->GetWorldContextFromPIEInstance(PIEInstance); }
+		bool CanTick() const
+		{
+			if (bIsSharedByWorlds)
+			{
+				// Shared context is alive as long as any of its worlds.
+				return ContextProxy->GetSharedWorlds().ContainsByPredicate([](int32 SharedPIEInstance)
+				{
+					return GEngine->GetWorldContextFromPIEInstance(SharedPIEInstance) != nullptr;
+				});
+			}
+
+			return PIEInstance < 0 || GEngine->GetWorldContextFromPIEInstance(PIEInstance);
+		}
 
 		int32 PIEInstance = -1;
+		bool bIsSharedByWorlds = false;
 		TUniquePtr<FImGuiContextProxy> ContextProxy;
 	};
 
@@ -93,8 +115,13 @@ private:
 	void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
 #endif
 
+#if WITH_EDITOR
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+#endif
+
 #if WITH_EDITOR
 	FContextData& GetEditorContextData();
+	FContextData& GetSharedPIEContextData();
 #endif
 
 #if !WITH_EDITOR
@@ -104,13 +131,32 @@ private:
 	FContextData& GetWorldContextData(const UWorld& World, int32* OutContextIndex = nullptr);
 
 	void SetDPIScale(const FImGuiDPIScaleInfo& ScaleInfo);
-	void BuildFontAtlas(const TMap<FName, TSharedPtr<ImFontConfig>>& CustomFontConfigs = {});
+	void SetMemoryCompactTimers();
+	void InitializeContextProxy(int32 ContextIndex, FImGuiContextProxy& ContextProxy);
+	void BuildFontAtlas(const TArray<TPair<FName, ImFontConfig>>& CustomFontConfigs = {});
+	void RetireFontAtlas();
+
+	void UpdateLazyFonts();
+	void BuildLazyFontsAsync();
+	void CancelLazyFonts();
 
 	TMap<int32, FContextData> Contexts;
 
 	ImFontAtlas FontAtlas;
 	TArray<TUniquePtr<ImFontAtlas>> FontResourcesToRelease;
 
+	// Indices of custom fonts in the font atlas.
+	TMap<FName, int32> FontIndices;
+
+	// Lazy fonts requested so far (once requested, they are always added to the font atlas).
+	TSet<FName> RequestedLazyFonts;
+	bool bLazyFontsPending = false;
+
+	// Atlas with requested lazy fonts built in the background.
+	TUniquePtr<ImFontAtlas> LazyFontAtlas;
+	TMap<FName, int32> LazyFontIndices;
+	TFuture<void> LazyFontAtlasTask;
+
 	FImGuiModuleSettings& Settings;
 
 	float DPIScale = -1.f;
@@ -2,18 +2,39 @@
 
 #include "ImGuiContextProxy.h"
 
+#include "ImGuiAllocationTracker.h"
 #include "ImGuiDelegatesContainer.h"
 #include "ImGuiInteroperability.h"
+#include "ImGuiModuleDebug.h"
+#include "ImGuiWindowOccluders.h"
 #include "VersionCompatibility.h"
 
 #include <GenericPlatform/GenericPlatformFile.h>
+#include <HAL/IConsoleManager.h>
 #include <Misc/Paths.h>
 
+#include <imgui_internal.h>
+
 
 static constexpr float DEFAULT_CANVAS_WIDTH = 3840.f;
 static constexpr float DEFAULT_CANVAS_HEIGHT = 2160.f;
 
 
+namespace CVars
+{
+	TAutoConsoleVariable<int> CullInvisibleWindows(TEXT("ImGui.CullInvisibleWindows"), 1,
+		TEXT("Whether ImGui windows outside of the visible part of the canvas should skip their items.\n")
+		TEXT("0: disabled, all windows are processed\n")
+		TEXT("1: enabled (default)"),
+		ECVF_Default);
+
+	TAutoConsoleVariable<int> CullOccludedWindows(TEXT("ImGui.CullOccludedWindows"), 1,
+		TEXT("Whether ImGui windows fully covered by opaque windows should be culled.\n")
+		TEXT("0: disabled, all windows are drawn\n")
+		TEXT("1: enabled (default)"),
+		ECVF_Default);
+}
+
 namespace
 {
 	FString GetSaveDirectory()
@@ -75,10 +96,17 @@ FImGuiContextProxy::FImGuiContextProxy(const FString& InName, int32 InContextInd
 	: Name(InName)
 	, ContextIndex(InContextIndex)
 	, IniFilename(TCHAR_TO_ANSI(*GetIniFile(InName)))
+	, FlightRecorder(InName)
 {
 	// Create context.
 	Context = ImGui::CreateContext(InFontAtlas);
 
+	// Start tracking window scopes.
+	WindowStats.Initialize(Context);
+
+	// Panels built in scratch contexts and composited into this one.
+	ParallelPanels = MakeUnique<FImGuiParallelPanelsHost>(*Context);
+
 	// Set this context in ImGui for initialization (any allocations will be tracked in this context).
 	SetAsCurrent();
 
@@ -98,6 +126,12 @@ FImGuiContextProxy::FImGuiContextProxy(const FString& InName, int32 InContextInd
 	// Initialize key mapping, so context can correctly interpret input state.
 	ImGuiInterops::SetUnrealKeyMap(IO);
 
+	// With Slate indices larger than ImGui ones, we can offset indices to support draw lists with more than 64K vertices.
+	if (sizeof(SlateIndex) > sizeof(ImDrawIdx))
+	{
+		IO.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+	}
+
 	// Begin frame to complete context initialization (this is to avoid problems with other systems calling to ImGui
 	// during startup).
 	BeginFrame();
@@ -105,6 +139,9 @@ FImGuiContextProxy::FImGuiContextProxy(const FString& InName, int32 InContextInd
 
 FImGuiContextProxy::~FImGuiContextProxy()
 {
+	// Scratch contexts need to be released before the font atlas that they share with this context.
+	ParallelPanels.Reset();
+
 	if (Context)
 	{
 		// It seems that to properly shutdown context we need to set it as the current one (at least in this framework
@@ -121,6 +158,81 @@ void FImGuiContextProxy::ResetDisplaySize()
 	DisplaySize = { DEFAULT_CANVAS_WIDTH, DEFAULT_CANVAS_HEIGHT };
 }
 
+FImGuiInputState& FImGuiContextProxy::GetInputState(int32 WorldContextIndex)
+{
+	// Worlds other than the one with the index of this context can only be here by sharing it.
+	if (WorldContextIndex == ContextIndex || WorldContextIndex == Utilities::INVALID_CONTEXT_INDEX)
+	{
+		return InputState;
+	}
+
+	TUniquePtr<FWorldView>& View = WorldViews.FindOrAdd(WorldContextIndex);
+	if (!View)
+	{
+		View = MakeUnique<FWorldView>();
+		View->DisplaySize = { DEFAULT_CANVAS_WIDTH, DEFAULT_CANVAS_HEIGHT };
+	}
+	return View->InputState;
+}
+
+void FImGuiContextProxy::SetDisplaySize(const FVector2D& Size, int32 WorldContextIndex)
+{
+	if (WorldContextIndex == ContextIndex || WorldContextIndex == Utilities::INVALID_CONTEXT_INDEX)
+	{
+		DisplaySize = Size;
+	}
+	else
+	{
+		// Make sure that the view exists.
+		GetInputState(WorldContextIndex);
+		WorldViews[WorldContextIndex]->DisplaySize = Size;
+	}
+}
+
+void FImGuiContextProxy::AddViewFocus(int32 WorldContextIndex, bool bHasKeyboardFocus)
+{
+	if (!SharedWorlds.Contains(WorldContextIndex))
+	{
+		return;
+	}
+
+	// Focused view wins over hovered ones. Between views with the same priority, the first reported one wins.
+	if (PendingActiveView == Utilities::INVALID_CONTEXT_INDEX || (bHasKeyboardFocus && !bIsPendingViewFocused))
+	{
+		PendingActiveView = WorldContextIndex;
+		bIsPendingViewFocused = bHasKeyboardFocus;
+	}
+}
+
+void FImGuiContextProxy::UpdateActiveView()
+{
+	if (PendingActiveView != Utilities::INVALID_CONTEXT_INDEX && PendingActiveView != ActiveView)
+	{
+		// Keys and buttons held in the previous view would never be released in this context.
+		Context->IO.ClearInputKeys();
+
+		ActiveView = PendingActiveView;
+
+		ActiveInputState = &GetInputState(ActiveView);
+		ActiveDisplaySize = &WorldViews[ActiveView]->DisplaySize;
+	}
+
+	PendingActiveView = Utilities::INVALID_CONTEXT_INDEX;
+	bIsPendingViewFocused = false;
+}
+
+void FImGuiContextProxy::AddVisibleRect(const FSlateRect& Rect)
+{
+	VisibleRect = bHasVisibleRect ? VisibleRect.Expand(Rect) : Rect;
+	bHasVisibleRect = true;
+}
+
+void FImGuiContextProxy::AddViewScale(float PixelsPerUnit, float SlateDPIScale)
+{
+	// Points are pixels divided by the total DPI scale, which is applied either here or in Slate.
+	GeometryQuality.AddViewDensity(PixelsPerUnit / FMath::Max(SlateDPIScale * DPIScale, KINDA_SMALL_NUMBER));
+}
+
 void FImGuiContextProxy::SetDPIScale(float Scale)
 {
 	if (DPIScale != Scale)
@@ -136,6 +248,99 @@ void FImGuiContextProxy::SetDPIScale(float Scale)
 	}
 }
 
+void FImGuiContextProxy::SetMemoryCompactTimer(float Seconds)
+{
+	Context->IO.ConfigMemoryCompactTimer = ToImGuiMemoryCompactTimer(Seconds);
+}
+
+void FImGuiContextProxy::CompactMemory()
+{
+	FGuardCurrentContext GuardContext;
+	SetAsCurrent();
+
+	ImGuiContext& G = *Context;
+
+	// Skip windows and tables used in this or the last frame, as their buffers would be immediately reallocated.
+	for (ImGuiWindow* Window : G.Windows)
+	{
+		if (!Window->Active && !Window->WasActive && !Window->MemoryCompacted)
+		{
+			ImGui::GcCompactTransientWindowBuffers(Window);
+		}
+	}
+
+	for (int32 Index = 0; Index < G.TablesLastTimeActive.Size; Index++)
+	{
+		if (G.TablesLastTimeActive[Index] >= 0.f && G.Tables.GetByIndex(Index)->LastFrameActive < G.FrameCount - 1)
+		{
+			ImGui::TableGcCompactTransientBuffers(G.Tables.GetByIndex(Index));
+		}
+	}
+
+	// Temporary table data is shared between tables and can be only released when no table is being built.
+	if (G.TablesTempDataStacked == 0)
+	{
+		for (ImGuiTableTempData& TempData : G.TablesTempData)
+		{
+			if (TempData.LastTimeActive >= 0.f)
+			{
+				ImGui::TableGcCompactTransientBuffers(&TempData);
+			}
+		}
+	}
+
+	// Miscellaneous buffers are in use until the end of the frame, so let ImGui release them in the next one.
+	G.GcCompactAll = true;
+
+	// Draw data from the last frame is only read during painting, so its buffers can be shrunk between frames.
+	for (FImGuiDrawList& DrawList : DrawLists)
+	{
+		DrawList.Shrink();
+	}
+	DrawLists.Shrink();
+}
+
+void FImGuiContextProxy::AddSharedWorld(int32 WorldContextIndex)
+{
+	if (!bIsWindowHookAdded)
+	{
+		// Start tagging windows with worlds that create them.
+		ImGuiContextHook Hook;
+		Hook.UserData = this;
+		Hook.Type = ImGuiContextHookType_BeginWindowPost;
+		Hook.Callback = &FImGuiContextProxy::OnBeginWindowPost;
+		ImGui::AddContextHook(Context, &Hook);
+
+		bIsWindowHookAdded = true;
+	}
+
+	SharedWorlds.AddUnique(WorldContextIndex);
+}
+
+void FImGuiContextProxy::RemoveSharedWorld(int32 WorldContextIndex)
+{
+	if (SharedWorlds.Remove(WorldContextIndex) == 0)
+	{
+		return;
+	}
+
+	// Keep the view, because its index can be reused by a new world, but don't carry its input over.
+	if (TUniquePtr<FWorldView>* View = WorldViews.Find(WorldContextIndex))
+	{
+		(*View)->InputState.Reset();
+	}
+
+	if (ActiveView == WorldContextIndex)
+	{
+		// Fall back to the context state, until another view becomes active.
+		Context->IO.ClearInputKeys();
+
+		ActiveView = Utilities::INVALID_CONTEXT_INDEX;
+		ActiveInputState = &InputState;
+		ActiveDisplaySize = &DisplaySize;
+	}
+}
+
 void FImGuiContextProxy::DrawEarlyDebug()
 {
 	if (bIsFrameStarted && !bIsDrawEarlyDebugCalled)
@@ -144,6 +349,16 @@ void FImGuiContextProxy::DrawEarlyDebug()
 
 		SetAsCurrent();
 
+		// Start parallel panels as early as possible, so they can be built while the world ticks.
+		{
+			FImGuiFlightRecorder::FScope RecorderScope(FlightRecorder, EImGuiFramePhase::ParallelPanels);
+			const TArrayView<const int32> Worlds = (SharedWorlds.Num() > 0) ? TArrayView<const int32>(SharedWorlds)
+				: TArrayView<const int32>(&ContextIndex, 1);
+			ParallelPanels->Launch(Worlds);
+		}
+
+		FImGuiFlightRecorder::FScope RecorderScope(FlightRecorder, EImGuiFramePhase::EarlyDebug);
+
 		// Delegates called in order specified in FImGuiDelegates.
 		BroadcastMultiContextEarlyDebug();
 		BroadcastWorldEarlyDebug();
@@ -161,6 +376,8 @@ void FImGuiContextProxy::DrawDebug()
 
 		SetAsCurrent();
 
+		FImGuiFlightRecorder::FScope RecorderScope(FlightRecorder, EImGuiFramePhase::Debug);
+
 		// Delegates called in order specified in FImGuiDelegates.
 		BroadcastWorldDebug();
 		BroadcastMultiContextDebug();
@@ -169,9 +386,19 @@ void FImGuiContextProxy::DrawDebug()
 
 void FImGuiContextProxy::Tick(float DeltaSeconds)
 {
+	// Contexts that tick on demand stay in their current frame until a new one is requested or input arrives.
+	if (bTickOnDemand && !bIsFrameRequested && !ActiveInputState->HasUpdates())
+	{
+		return;
+	}
+
 	// Making sure that we tick only once per frame.
 	if (LastFrameNumber < GFrameNumber)
 	{
+		bIsFrameRequested = false;
+
+		SCOPE_CYCLE_COUNTER(STAT_ImGuiContextUpdate);
+
 		LastFrameNumber = GFrameNumber;
 
 		SetAsCurrent();
@@ -181,6 +408,12 @@ void FImGuiContextProxy::Tick(float DeltaSeconds)
 			// Make sure that draw events are called before the end of the frame.
 			DrawDebug();
 
+			// Wait for parallel panels and add their windows, while the frame is still open.
+			{
+				FImGuiFlightRecorder::FScope RecorderScope(FlightRecorder, EImGuiFramePhase::ParallelPanels);
+				ParallelPanels->Composite();
+			}
+
 			// Ending frame will produce render output that we capture and store for later use. This also puts context to
 			// state in which it does not allow to draw controls, so we want to immediately start a new frame.
 			EndFrame();
@@ -203,16 +436,40 @@ void FImGuiContextProxy::BeginFrame(float DeltaTime)
 {
 	if (!bIsFrameStarted)
 	{
+		FImGuiFlightRecorder::FScope RecorderScope(FlightRecorder, EImGuiFramePhase::NewFrame);
+
 		ImGuiIO& IO = ImGui::GetIO();
 		IO.DeltaTime = DeltaTime;
 
-		ImGuiInterops::CopyInput(IO, InputState);
-		InputState.ClearUpdateState();
+		// Views reported in the last frame decide which of them drives this one.
+		UpdateActiveView();
+
+		ImGuiInterops::CopyInput(IO, *ActiveInputState);
+		ParallelPanels->BeginFrame(*ActiveInputState);
+		ActiveInputState->ClearUpdateState();
 
-		IO.DisplaySize = { (float)DisplaySize.X, (float)DisplaySize.Y };
+		IO.DisplaySize = { (float)ActiveDisplaySize->X, (float)ActiveDisplaySize->Y };
+
+		// Visible parts reported in the last frame apply to this one.
+		if (bHasVisibleRect && CVars::CullInvisibleWindows.GetValueOnGameThread() > 0)
+		{
+			Context->WindowsVisibleRect = ImRect{ (float)VisibleRect.Left, (float)VisibleRect.Top,
+				(float)VisibleRect.Right, (float)VisibleRect.Bottom };
+		}
+		else
+		{
+			Context->WindowsVisibleRect = ImRect{ -FLT_MAX, -FLT_MAX, FLT_MAX, FLT_MAX };
+		}
+		bHasVisibleRect = false;
+
+		// Density reported in the last frame applies to this one.
+		GeometryQuality.BeginFrame(ImGui::GetStyle());
 
 		ImGui::NewFrame();
 
+		// Adapted values are already copied to the draw list data, so the style can go back to values set by the user.
+		GeometryQuality.RestoreStyle(ImGui::GetStyle());
+
 		bIsFrameStarted = true;
 		bIsDrawEarlyDebugCalled = false;
 		bIsDrawDebugCalled = false;
@@ -221,14 +478,38 @@ void FImGuiContextProxy::BeginFrame(float DeltaTime)
 
 void FImGuiContextProxy::EndFrame()
 {
+	// Parallel panels are built inside of the frame, which keeps the shared font atlas locked for them.
+	if (bIsFrameStarted)
+	{
+		ParallelPanels->Wait();
+	}
+
 	if (bIsFrameStarted)
 	{
 		// Prepare draw data (after this call we cannot draw to this context until we start a new frame).
-		ImGui::Render();
+		{
+			FImGuiFlightRecorder::FScope RecorderScope(FlightRecorder, EImGuiFramePhase::Render);
+			ImGui::Render();
+		}
+
+		if (ImDrawData* DrawData = ImGui::GetDrawData())
+		{
+			CullOccludedWindows(*DrawData);
+			GeometryQuality.EndFrame(DrawData->TotalVtxCount);
+		}
+
+		// Needs to be done before transfer, which clears source lists.
+		FlightRecorder.RecordFrameData(*Context, ImGui::GetDrawData());
 
 		// Update our draw data, so we can use them later during Slate rendering while ImGui is in the middle of the
 		// next frame.
-		UpdateDrawData(ImGui::GetDrawData());
+		{
+			FImGuiFlightRecorder::FScope RecorderScope(FlightRecorder, EImGuiFramePhase::DrawData);
+			UpdateDrawData(ImGui::GetDrawData());
+			UpdateCursorDrawData();
+		}
+
+		FlightRecorder.EndFrame();
 
 		bIsFrameStarted = false;
 	}
@@ -238,11 +519,16 @@ void FImGuiContextProxy::UpdateDrawData(ImDrawData* DrawData)
 {
 	if (DrawData && DrawData->CmdListsCount > 0)
 	{
+		IMGUI_TRACK_CONTAINER_GROWTH(DrawLists);
 		DrawLists.SetNum(DrawData->CmdListsCount, false);
 
+		// Needs to be done before transfer, which clears source lists.
+		UpdateDrawListWorlds(*DrawData);
+
 		for (int Index = 0; Index < DrawData->CmdListsCount; Index++)
 		{
 			DrawLists[Index].TransferDrawData(*DrawData->CmdLists[Index]);
+			WindowStats.AddDrawList(DrawData->CmdLists[Index], DrawLists[Index]);
 		}
 	}
 	else
@@ -250,11 +536,195 @@ void FImGuiContextProxy::UpdateDrawData(ImDrawData* DrawData)
 		// If we are not rendering then this might be a good moment to empty the array.
 		DrawLists.Empty();
 	}
+
+	WindowStats.EndFrame();
+}
+
+void FImGuiContextProxy::UpdateCursorDrawData()
+{
+	// This follows ImGui::RenderMouseCursor, but draws to our own list instead of the foreground one.
+	bHasCursorDrawData = false;
+
+	const ImGuiMouseCursor Cursor = Context->MouseCursor;
+	if (!ActiveInputState->HasMousePointer() || Cursor <= ImGuiMouseCursor_None || Cursor >= ImGuiMouseCursor_COUNT
+		|| !ImGui::IsMousePosValid(&Context->IO.MousePos))
+	{
+		return;
+	}
+
+	ImFontAtlas* FontAtlas = Context->IO.Fonts;
+	ImVec2 Offset, Size, UV[4];
+	if (!FontAtlas->GetMouseCursorTexData(Cursor, &Offset, &Size, &UV[0], &UV[2]))
+	{
+		return;
+	}
+
+	if (!CursorImGuiDrawList)
+	{
+		CursorImGuiDrawList = MakeUnique<ImDrawList>(&Context->DrawListSharedData);
+	}
+
+	ImDrawList& DrawList = *CursorImGuiDrawList;
+	DrawList._ResetForNewFrame();
+	DrawList.PushClipRectFullScreen();
+	DrawList.PushTextureID(FontAtlas->TexID);
+
+	const ImVec2 Position = Context->IO.MousePos - Offset;
+	const float Scale = Context->Style.MouseCursorScale;
+	const ImU32 ShadowColor = IM_COL32(0, 0, 0, 48);
+	DrawList.AddImage(FontAtlas->TexID, Position + ImVec2(1, 0) * Scale, Position + (ImVec2(1, 0) + Size) * Scale, UV[2], UV[3], ShadowColor);
+	DrawList.AddImage(FontAtlas->TexID, Position + ImVec2(2, 0) * Scale, Position + (ImVec2(2, 0) + Size) * Scale, UV[2], UV[3], ShadowColor);
+	DrawList.AddImage(FontAtlas->TexID, Position, Position + Size * Scale, UV[2], UV[3], IM_COL32_BLACK);
+	DrawList.AddImage(FontAtlas->TexID, Position, Position + Size * Scale, UV[0], UV[1], IM_COL32_WHITE);
+
+	DrawList.PopTextureID();
+	DrawList.PopClipRect();
+	DrawList._PopUnusedDrawCmd();
+
+	CursorDrawList.TransferDrawData(DrawList);
+	bHasCursorDrawData = true;
+}
+
+void FImGuiContextProxy::UpdateDrawListWorlds(ImDrawData& DrawData)
+{
+	if (WindowWorlds.Num() > 0)
+	{
+		DrawListWorlds.Reset();
+		for (const ImGuiWindow* Window : Context->Windows)
+		{
+			if (const int32* World = WindowWorlds.Find(Window->ID))
+			{
+				DrawListWorlds.Add(Window->DrawList, *World);
+			}
+		}
+
+		for (int Index = 0; Index < DrawData.CmdListsCount; Index++)
+		{
+			const int32* World = DrawListWorlds.Find(DrawData.CmdLists[Index]);
+			DrawLists[Index].SetWorldContextIndex(World ? *World : INDEX_NONE);
+		}
+	}
+	else
+	{
+		for (FImGuiDrawList& DrawList : DrawLists)
+		{
+			DrawList.SetWorldContextIndex(INDEX_NONE);
+		}
+	}
+}
+
+void FImGuiContextProxy::CullOccludedWindows(ImDrawData& DrawData)
+{
+	NumOccludedWindows = 0;
+	NumOccludedVertices = 0;
+
+	const bool bEnabled = CVars::CullOccludedWindows.GetValueOnGameThread() > 0;
+
+	// Focused window should be in front, but it can stay behind other windows if it doesn't bring itself to front.
+	const ImGuiWindow* FocusedRootWindow = Context->NavWindow ? Context->NavWindow->RootWindow : nullptr;
+
+	// Walk root windows from front to back, checking them against opaque parts of visible windows in front of them.
+	// Windows found occluded are hidden in the next frame (see Begin), so they don't need to submit their items. In
+	// shared contexts, windows can only occlude windows that are drawn in the same viewports.
+	FImGuiWindowOccluders Occluders;
+	for (int32 Index = Context->Windows.Size - 1; Index >= 0; Index--)
+	{
+		ImGuiWindow* Window = Context->Windows[Index];
+		if (Window->RootWindow != Window)
+		{
+			continue;
+		}
+
+		Window->Occluded = false;
+		if (!bEnabled || !Window->Active)
+		{
+			continue;
+		}
+
+		const int32* WindowWorld = WindowWorlds.Find(Window->ID);
+		const int32 World = WindowWorld ? *WindowWorld : INDEX_NONE;
+
+		if (Window != FocusedRootWindow)
+		{
+			Window->Occluded = Occluders.IsOccluded(Window->Rect(), World);
+		}
+
+		if (Window->Occluded)
+		{
+			NumOccludedWindows++;
+		}
+		else if (!Window->Hidden && !Window->OpaqueRect.IsInverted())
+		{
+			Occluders.Add(Window->OpaqueRect, World);
+		}
+	}
+
+	if (NumOccludedWindows > 0)
+	{
+		// Windows occluded in this frame might be already rendered, so we drop their draw lists (child windows follow
+		// their roots).
+		TSet<const ImDrawList*, DefaultKeyFuncs<const ImDrawList*>, TInlineSetAllocator<32>> OccludedDrawLists;
+		for (const ImGuiWindow* Window : Context->Windows)
+		{
+			if (Window->Active && !Window->Hidden && Window->RootWindow->Occluded)
+			{
+				OccludedDrawLists.Add(Window->DrawList);
+			}
+		}
+
+		int32 NumLists = 0;
+		for (ImDrawList* DrawList : DrawData.CmdLists)
+		{
+			if (OccludedDrawLists.Contains(DrawList))
+			{
+				NumOccludedVertices += DrawList->VtxBuffer.Size;
+				DrawData.TotalVtxCount -= DrawList->VtxBuffer.Size;
+				DrawData.TotalIdxCount -= DrawList->IdxBuffer.Size;
+			}
+			else
+			{
+				DrawData.CmdLists[NumLists++] = DrawList;
+			}
+		}
+		DrawData.CmdLists.resize(NumLists);
+		DrawData.CmdListsCount = NumLists;
+	}
+
+	INC_DWORD_STAT_BY(STAT_ImGuiOccludedWindows, NumOccludedWindows);
+	INC_DWORD_STAT_BY(STAT_ImGuiOccludedVertices, NumOccludedVertices);
+}
+
+void FImGuiContextProxy::OnBeginWindowPost(ImGuiContext* HookContext, ImGuiContextHook* Hook)
+{
+	FImGuiContextProxy& Proxy = *static_cast<FImGuiContextProxy*>(Hook->UserData);
+
+	// Windows belong to the world that used them last.
+	const ImGuiID WindowId = HookContext->CurrentWindow->ID;
+	if (Proxy.CurrentWorld != INDEX_NONE)
+	{
+		Proxy.WindowWorlds.Add(WindowId, Proxy.CurrentWorld);
+	}
+	else if (Proxy.WindowWorlds.Num() > 0)
+	{
+		Proxy.WindowWorlds.Remove(WindowId);
+	}
 }
 
 void FImGuiContextProxy::BroadcastWorldEarlyDebug()
 {
-	if (ContextIndex != Utilities::INVALID_CONTEXT_INDEX)
+	if (SharedWorlds.Num() > 0)
+	{
+		for (int32 WorldIndex : SharedWorlds)
+		{
+			FSimpleMulticastDelegate& WorldEarlyDebugEvent = FImGuiDelegatesContainer::Get().OnWorldEarlyDebug(WorldIndex);
+			if (WorldEarlyDebugEvent.IsBound())
+			{
+				TGuardValue<int32> CurrentWorldGuard(CurrentWorld, WorldIndex);
+				WorldEarlyDebugEvent.Broadcast();
+			}
+		}
+	}
+	else if (ContextIndex != Utilities::INVALID_CONTEXT_INDEX)
 	{
 		FSimpleMulticastDelegate& WorldEarlyDebugEvent = FImGuiDelegatesContainer::Get().OnWorldEarlyDebug(ContextIndex);
 		if (WorldEarlyDebugEvent.IsBound())
@@ -280,7 +750,19 @@ void FImGuiContextProxy::BroadcastWorldDebug()
 		DrawEvent.Broadcast();
 	}
 
-	if (ContextIndex != Utilities::INVALID_CONTEXT_INDEX)
+	if (SharedWorlds.Num() > 0)
+	{
+		for (int32 WorldIndex : SharedWorlds)
+		{
+			FSimpleMulticastDelegate& WorldDebugEvent = FImGuiDelegatesContainer::Get().OnWorldDebug(WorldIndex);
+			if (WorldDebugEvent.IsBound())
+			{
+				TGuardValue<int32> CurrentWorldGuard(CurrentWorld, WorldIndex);
+				WorldDebugEvent.Broadcast();
+			}
+		}
+	}
+	else if (ContextIndex != Utilities::INVALID_CONTEXT_INDEX)
 	{
 		FSimpleMulticastDelegate& WorldDebugEvent = FImGuiDelegatesContainer::Get().OnWorldDebug(ContextIndex);
 		if (WorldDebugEvent.IsBound())
@@ -3,7 +3,11 @@
 #pragma once
 
 #include "ImGuiDrawData.h"
+#include "ImGuiFlightRecorder.h"
+#include "ImGuiGeometryQuality.h"
 #include "ImGuiInputState.h"
+#include "ImGuiParallelPanelsHost.h"
+#include "ImGuiWindowStats.h"
 #include "Utilities/WorldContextIndex.h"
 
 #include <GenericPlatform/ICursor.h>
@@ -34,9 +38,15 @@ public:
 	// Get draw data from the last frame.
 	const TArray<FImGuiDrawList>& GetDrawData() const { return DrawLists; }
 
-	// Get input state used by this context.
-	FImGuiInputState& GetInputState() { return InputState; }
-	const FImGuiInputState& GetInputState() const { return InputState; }
+	// Get input state used by this context. In a context shared by multiple worlds, this is the state of the view that
+	// currently drives the context.
+	FImGuiInputState& GetInputState() { return *ActiveInputState; }
+	const FImGuiInputState& GetInputState() const { return *ActiveInputState; }
+
+	// Get input state for a view of a world. Worlds sharing this context have their own input states, which only drive
+	// this context while their views are active (see AddViewFocus).
+	// @param WorldContextIndex - Index of the world displayed in the view
+	FImGuiInputState& GetInputState(int32 WorldContextIndex);
 
 	// Is this context the current ImGui context.
 	bool IsCurrentContext() const { return ImGui::GetCurrentContext() == Context; }
@@ -44,21 +54,57 @@ public:
 	// Set this context as current ImGui context.
 	void SetAsCurrent() { ImGui::SetCurrentContext(Context); }
 
-	// Get the desired context display size.
-	const FVector2D& GetDisplaySize() const { return DisplaySize; }
+	// Get the desired context display size (of the active view in a context shared by multiple worlds).
+	const FVector2D& GetDisplaySize() const { return *ActiveDisplaySize; }
 
-	// Set the desired context display size.
-	void SetDisplaySize(const FVector2D& Size) { DisplaySize = Size; }
+	// Set the desired context display size. Worlds sharing this context keep their own sizes, which are only used while
+	// their views are active.
+	// @param Size - Desired display size
+	// @param WorldContextIndex - Index of the world displayed in the view or invalid index for the whole context
+	void SetDisplaySize(const FVector2D& Size, int32 WorldContextIndex = Utilities::INVALID_CONTEXT_INDEX);
 
 	// Reset the desired context display size to default size.
 	void ResetDisplaySize();
 
+	// Add a part of the display visible in a widget. Parts added before the next frame are combined and windows outside
+	// of them skip their items in that frame. Without any visible parts added, all windows are processed.
+	// @param Rect - Visible part of the display in ImGui space
+	void AddVisibleRect(const FSlateRect& Rect);
+
+	// Set whether this context should only tick in frames in which a new frame is requested or input arrives. Between
+	// those ticks, the current frame stays open and draw data from the last one is kept. Debug events are only
+	// broadcast once per frame, so idle contexts don't call them, but ImGui calls made outside of them while this
+	// context is current are added to the open frame.
+	void SetTickOnDemand(bool bEnabled) { bTickOnDemand = bEnabled; }
+
+	// Request the next tick of a context that ticks on demand.
+	void RequestFrame() { bIsFrameRequested = true; }
+
+	// Add the scale at which a widget displays this context. Geometry quality in the next frame adapts to the highest
+	// density added before it (see FImGuiGeometryQuality).
+	// @param PixelsPerUnit - Number of screen pixels per ImGui unit
+	// @param SlateDPIScale - DPI scale applied in Slate (without the one applied in this context)
+	void AddViewScale(float PixelsPerUnit, float SlateDPIScale = 1.f);
+
 	// Get the DPI scale set for this context.
 	float GetDPIScale() const { return DPIScale; }
 
 	// Set the DPI scale for this context.
 	void SetDPIScale(float Scale);
 
+	// Set the time in seconds after which transient buffers of unused windows and tables are released. Negative value
+	// disables compaction.
+	void SetMemoryCompactTimer(float Seconds);
+
+	// Convert the compaction time to the ImGui timer. ImGui compacts all unused buffers in every frame when its timer
+	// is negative, so disabled compaction is mapped to a timer that never fires.
+	static float ToImGuiMemoryCompactTimer(float Seconds) { return (Seconds < 0.f) ? FLT_MAX : Seconds; }
+
+	// Immediately release transient buffers of windows and tables that are not used in the current frame. Remaining
+	// transient buffers are released at the beginning of the next frame. Buffers of the stored draw data are shrunk to
+	// their content.
+	void CompactMemory();
+
 	// Whether this context has an active item (read once per frame during context update).
 	bool HasActiveItem() const { return bHasActiveItem; }
 
@@ -68,6 +114,47 @@ public:
 	// Cursor type desired by this context (updated once per frame during context update).
 	EMouseCursor::Type GetMouseCursor() const { return MouseCursor;  }
 
+	// Get the draw list with the software cursor or null, if the cursor is not drawn. The cursor is kept out of the main
+	// draw data, so mouse movement alone doesn't change it.
+	const FImGuiDrawList* GetCursorDrawData() const { return bHasCursorDrawData ? &CursorDrawList : nullptr; }
+
+	// Get the number of windows occluded by opaque windows in front of them in the last frame.
+	int32 GetNumOccludedWindows() const { return NumOccludedWindows; }
+
+	// Get the number of vertices dropped from the last frame because their windows were occluded.
+	int32 GetNumOccludedVertices() const { return NumOccludedVertices; }
+
+	// Get geometry quality state of this context.
+	const FImGuiGeometryQuality& GetGeometryQuality() const { return GeometryQuality; }
+
+	// Get per-window costs collected in this context.
+	const FImGuiWindowStats& GetWindowStats() const { return WindowStats; }
+
+	// Get the flight recorder that keeps timings of the last frames of this context.
+	FImGuiFlightRecorder& GetFlightRecorder() { return FlightRecorder; }
+
+	// Share this context with a world. Debug events of all shared worlds are broadcast together and windows created in
+	// those events are tagged with the index of their world, so widgets can draw only windows that belong to them.
+	// Windows are identified by names, so worlds should use unique names for windows that they don't want to share.
+	void AddSharedWorld(int32 WorldContextIndex);
+
+	// Stop sharing this context with a world, e.g. when the world is torn down. Its view stops driving this context.
+	void RemoveSharedWorld(int32 WorldContextIndex);
+
+	// Get indices of worlds sharing this context.
+	const TArray<int32>& GetSharedWorlds() const { return SharedWorlds; }
+
+	// Report that a view of a world sharing this context is hovered or has keyboard focus. The focused view takes
+	// precedence over hovered ones and drives input and display size of this context from the next frame. Without
+	// reports, the last active view keeps driving the context.
+	// @param WorldContextIndex - Index of the world displayed in the view
+	// @param bHasKeyboardFocus - Whether the view has keyboard focus
+	void AddViewFocus(int32 WorldContextIndex, bool bHasKeyboardFocus);
+
+	// Wait until parallel panels of this context are built. Should be called before changing resources shared with
+	// them, like the font atlas.
+	void WaitForParallelPanels() { ParallelPanels->Wait(); }
+
 	// Internal draw event used to draw module's examples and debug widgets. Unlike the delegates container, it is not
 	// passed when the module is reloaded, so all objects that are unloaded with the module should register here.
 	FSimpleMulticastDelegate& OnDraw() { return DrawEvent; }
@@ -88,7 +175,10 @@ public:
 	void EndFrame();
 private:
 
+	void UpdateActiveView();
+
 	void UpdateDrawData(ImDrawData* DrawData);
+	void UpdateCursorDrawData();
 
 	void BroadcastWorldEarlyDebug();
 	void BroadcastMultiContextEarlyDebug();
@@ -96,9 +186,18 @@ private:
 	void BroadcastWorldDebug();
 	void BroadcastMultiContextDebug();
 
+	void UpdateDrawListWorlds(ImDrawData& DrawData);
+
+	void CullOccludedWindows(ImDrawData& DrawData);
+
+	static void OnBeginWindowPost(ImGuiContext* HookContext, ImGuiContextHook* Hook);
+
 	ImGuiContext* Context;
 
 	FVector2D DisplaySize = FVector2D::ZeroVector;
+
+	FSlateRect VisibleRect;
+	bool bHasVisibleRect = false;
 	float DPIScale = 1.f;
 
 	EMouseCursor::Type MouseCursor = EMouseCursor::None;
@@ -109,10 +208,52 @@ private:
 	bool bIsDrawEarlyDebugCalled = false;
 	bool bIsDrawDebugCalled = false;
 
+	bool bTickOnDemand = false;
+	bool bIsFrameRequested = false;
+
 	FImGuiInputState InputState;
 
+	// Input and display size of a view of a world sharing this context.
+	struct FWorldView
+	{
+		FImGuiInputState InputState;
+		FVector2D DisplaySize = FVector2D::ZeroVector;
+	};
+
+	// Views are kept after their worlds are removed, because world indices are reused and input handlers may still
+	// point to their input states.
+	TMap<int32, TUniquePtr<FWorldView>> WorldViews;
+
+	// Input state and display size used in the current frame: either the context ones or the ones of the active view.
+	FImGuiInputState* ActiveInputState = &InputState;
+	FVector2D* ActiveDisplaySize = &DisplaySize;
+	int32 ActiveView = Utilities::INVALID_CONTEXT_INDEX;
+	int32 PendingActiveView = Utilities::INVALID_CONTEXT_INDEX;
+	bool bIsPendingViewFocused = false;
+
 	TArray<FImGuiDrawList> DrawLists;
 
+	TUniquePtr<ImDrawList> CursorImGuiDrawList;
+	FImGuiDrawList CursorDrawList;
+	bool bHasCursorDrawData = false;
+
+	FImGuiWindowStats WindowStats;
+
+	int32 NumOccludedWindows = 0;
+	int32 NumOccludedVertices = 0;
+
+	FImGuiGeometryQuality GeometryQuality;
+
+	TUniquePtr<FImGuiParallelPanelsHost> ParallelPanels;
+
+	TArray<int32> SharedWorlds;
+	TMap<ImGuiID, int32> WindowWorlds;
+	bool bIsWindowHookAdded = false;
+	int32 CurrentWorld = INDEX_NONE;
+
+	// Worlds of draw lists in the current frame, kept between frames to reuse the allocation.
+	TMap<const ImDrawList*, int32> DrawListWorlds;
+
 	FString Name;
 	int32 ContextIndex = Utilities::INVALID_CONTEXT_INDEX;
 
@@ -121,4 +262,6 @@ private:
 	FSimpleMulticastDelegate DrawEvent;
 
 	std::string IniFilename;
+
+	FImGuiFlightRecorder FlightRecorder;
 };
@@ -0,0 +1,53 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiDebugDraw.h"
+
+#include "ImGuiDebugDrawBatcher.h"
+
+#include <DrawDebugHelpers.h>
+
+
+namespace
+{
+	constexpr int32 MinSphereSegments = 4;
+	constexpr int32 MaxSphereSegments = 64;
+
+	uint8 GetDepthPriority(bool bForeground)
+	{
+		return bForeground ? SDPG_Foreground : SDPG_World;
+	}
+}
+
+void FImGuiDebugDraw::Line(const UWorld* World, const FVector& Start, const FVector& End, const FColor& Color, float Thickness, bool bForeground)
+{
+#if ENABLE_DRAW_DEBUG
+	if (World)
+	{
+		FImGuiDebugDrawBatcher::RecordLine(World, Thickness, GetDepthPriority(bForeground),
+			{ FImGuiDebugVector{ Start }, FImGuiDebugVector{ End }, Color });
+	}
+#endif // ENABLE_DRAW_DEBUG
+}
+
+void FImGuiDebugDraw::Box(const UWorld* World, const FVector& Center, const FVector& Extent, const FQuat& Rotation, const FColor& Color, float Thickness, bool bForeground)
+{
+#if ENABLE_DRAW_DEBUG
+	if (World)
+	{
+		FImGuiDebugDrawBatcher::RecordShape(World, Thickness, GetDepthPriority(bForeground),
+			{ FImGuiDebugVector{ Center }, FImGuiDebugVector{ Extent }, FImGuiDebugQuat{ Rotation }, Color, EImGuiDebugShape::Box, 0 });
+	}
+#endif // ENABLE_DRAW_DEBUG
+}
+
+void FImGuiDebugDraw::Sphere(const UWorld* World, const FVector& Center, float Radius, int32 Segments, const FColor& Color, float Thickness, bool bForeground)
+{
+#if ENABLE_DRAW_DEBUG
+	if (World)
+	{
+		const uint8 ClampedSegments = static_cast<uint8>(FMath::Clamp(Segments, MinSphereSegments, MaxSphereSegments));
+		FImGuiDebugDrawBatcher::RecordShape(World, Thickness, GetDepthPriority(bForeground),
+			{ FImGuiDebugVector{ Center }, FImGuiDebugVector{ Radius, 0.f, 0.f }, FImGuiDebugQuat::Identity, Color, EImGuiDebugShape::Sphere, ClampedSegments });
+	}
+#endif // ENABLE_DRAW_DEBUG
+}
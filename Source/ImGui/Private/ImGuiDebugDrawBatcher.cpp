@@ -0,0 +1,523 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiDebugDrawBatcher.h"
+
+#include "ImGuiAllocationTracker.h"
+#include "ImGuiModuleDebug.h"
+
+#include <Async/ParallelFor.h>
+#include <Camera/PlayerCameraManager.h>
+#include <ConvexVolume.h>
+#include <Engine/GameViewportClient.h>
+#include <Engine/LocalPlayer.h>
+#include <Engine/World.h>
+#include <GameFramework/PlayerController.h>
+#include <HAL/PlatformProcess.h>
+#include <Math/InverseRotationMatrix.h>
+#include <Math/PerspectiveMatrix.h>
+#include <Math/TranslationMatrix.h>
+#include <Misc/ScopeLock.h>
+
+#include <atomic>
+
+
+DEFINE_LOG_CATEGORY_STATIC(LogImGuiDebugDraw, Log, All);
+
+namespace
+{
+	struct FThreadBuffer
+	{
+		// Batches of both epoch parities and indices of the last used batches (cached for consecutive calls).
+		TArray<FImGuiDebugBatch> Batches[2];
+		int32 LastBatch[2] = { INDEX_NONE, INDEX_NONE };
+
+		// Set while a thread is recording, so merge knows when it is safe to read batches.
+		std::atomic<bool> bRecording{ false };
+	};
+
+	std::atomic<uint32> Epoch{ 0 };
+
+	// Buffers of all threads that recorded something. Lock is only taken to register a new buffer and to merge.
+	FCriticalSection BuffersLock;
+	TArray<TUniquePtr<FThreadBuffer>> Buffers;
+
+	thread_local FThreadBuffer* ThreadBuffer = nullptr;
+
+	FThreadBuffer& GetThreadBuffer()
+	{
+		if (UNLIKELY(!ThreadBuffer))
+		{
+			FScopeLock Lock(&BuffersLock);
+			ThreadBuffer = Buffers.Add_GetRef(MakeUnique<FThreadBuffer>()).Get();
+		}
+		return *ThreadBuffer;
+	}
+
+	FImGuiDebugBatch& FindOrAddBatch(TArray<FImGuiDebugBatch>& Batches, const void* Target, float Thickness, uint8 DepthPriority)
+	{
+		FImGuiDebugBatch* Batch = Batches.FindByPredicate([&](const FImGuiDebugBatch& Candidate)
+		{
+			return Candidate.Matches(Target, Thickness, DepthPriority);
+		});
+
+		if (!Batch)
+		{
+			Batch = &Batches.AddDefaulted_GetRef();
+			Batch->Target = Target;
+			Batch->Thickness = Thickness;
+			Batch->DepthPriority = DepthPriority;
+		}
+
+		return *Batch;
+	}
+
+	template<typename TRecordFunction>
+	FORCEINLINE void Record(const void* Target, float Thickness, uint8 DepthPriority, TRecordFunction&& RecordFunction)
+	{
+		FThreadBuffer& Buffer = GetThreadBuffer();
+
+		// Buffer needs to be marked as busy before reading the epoch (both with sequential consistency), so merge that
+		// advances the epoch either waits for this call or this call sees the new epoch.
+		Buffer.bRecording.store(true);
+		const uint32 Parity = Epoch.load() & 1;
+
+		TArray<FImGuiDebugBatch>& Batches = Buffer.Batches[Parity];
+		int32& LastBatch = Buffer.LastBatch[Parity];
+		if (!Batches.IsValidIndex(LastBatch) || !Batches[LastBatch].Matches(Target, Thickness, DepthPriority))
+		{
+			LastBatch = static_cast<int32>(&FindOrAddBatch(Batches, Target, Thickness, DepthPriority) - Batches.GetData());
+		}
+		RecordFunction(Batches[LastBatch]);
+
+		Buffer.bRecording.store(false, std::memory_order_release);
+	}
+
+	// Get the number of lines in a tessellated shape.
+	int32 GetNumLines(const FImGuiDebugShape& Shape)
+	{
+		return (Shape.Type == EImGuiDebugShape::Box) ? 12 : Shape.Segments * 3;
+	}
+
+	// Get the radius of a sphere that bounds a shape.
+	float GetBoundingRadius(const FImGuiDebugShape& Shape)
+	{
+		return (Shape.Type == EImGuiDebugShape::Box) ? Shape.Extent.Size() : Shape.Extent.X;
+	}
+
+	// Conservative test that rejects lines with both ends outside of the same frustum plane. Lines that cross a corner
+	// of the frustum can pass the test, but it is much cheaper than clipping.
+	FORCEINLINE bool IsOutside(const FConvexVolume& Frustum, const FVector& Start, const FVector& End)
+	{
+		for (const FPlane& Plane : Frustum.Planes)
+		{
+			if (Plane.PlaneDot(Start) > 0.f && Plane.PlaneDot(End) > 0.f)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Check whether a line is outside of all views, so it can be culled.
+	bool IsOutside(TArrayView<const FConvexVolume> Frustums, const FVector& Start, const FVector& End)
+	{
+		for (const FConvexVolume& Frustum : Frustums)
+		{
+			if (!IsOutside(Frustum, Start, End))
+			{
+				return false;
+			}
+		}
+		return Frustums.Num() > 0;
+	}
+
+	// Check whether a sphere is outside of all views, so it can be culled.
+	bool IsOutside(TArrayView<const FConvexVolume> Frustums, const FVector& Center, float Radius)
+	{
+		for (const FConvexVolume& Frustum : Frustums)
+		{
+			if (Frustum.IntersectSphere(Center, Radius))
+			{
+				return false;
+			}
+		}
+		return Frustums.Num() > 0;
+	}
+
+	template<typename TAddLineFunction>
+	void TessellateShape(const FImGuiDebugShape& Shape, TAddLineFunction&& AddLine)
+	{
+		const FVector Center{ Shape.Center };
+		const FVector Extent{ Shape.Extent };
+		const FQuat Rotation{ Shape.Rotation };
+
+		if (Shape.Type == EImGuiDebugShape::Box)
+		{
+			FVector Corners[8];
+			for (int32 Index = 0; Index < 8; Index++)
+			{
+				const FVector Corner{ (Index & 1) ? Extent.X : -Extent.X, (Index & 2) ? Extent.Y : -Extent.Y, (Index & 4) ? Extent.Z : -Extent.Z };
+				Corners[Index] = Center + Rotation.RotateVector(Corner);
+			}
+
+			// Edges connect corners that differ in one axis.
+			for (int32 Index = 0; Index < 8; Index++)
+			{
+				for (int32 Axis = 1; Axis < 8; Axis <<= 1)
+				{
+					if ((Index & Axis) == 0)
+					{
+						AddLine(Corners[Index], Corners[Index | Axis]);
+					}
+				}
+			}
+		}
+		else
+		{
+			const FVector Axes[3] = { Rotation.GetAxisX(), Rotation.GetAxisY(), Rotation.GetAxisZ() };
+			for (int32 Circle = 0; Circle < 3; Circle++)
+			{
+				const FVector U = Axes[Circle] * Extent.X;
+				const FVector V = Axes[(Circle + 1) % 3] * Extent.X;
+
+				FVector Previous = Center + U;
+				for (int32 Segment = 1; Segment <= Shape.Segments; Segment++)
+				{
+					float Sin, Cos;
+					FMath::SinCos(&Sin, &Cos, 2.f * PI * Segment / Shape.Segments);
+
+					const FVector Point = Center + U * Cos + V * Sin;
+					AddLine(Previous, Point);
+					Previous = Point;
+				}
+			}
+		}
+	}
+
+	void GetViewFrustum(const FVector& Location, const FRotator& Rotation, float FOV, float AspectRatio, FConvexVolume& OutFrustum)
+	{
+		// Same view and projection as in local player views, with the horizontal field of view.
+		const FMatrix ViewMatrix = FTranslationMatrix(-Location) * FInverseRotationMatrix(Rotation)
+			* FMatrix(FPlane(0.f, 0.f, 1.f, 0.f), FPlane(1.f, 0.f, 0.f, 0.f), FPlane(0.f, 1.f, 0.f, 0.f), FPlane(0.f, 0.f, 0.f, 1.f));
+
+		const float HalfFOV = FMath::DegreesToRadians(FOV) * 0.5f;
+		const FMatrix ProjectionMatrix = FReversedZPerspectiveMatrix(HalfFOV, HalfFOV, 1.f, AspectRatio, 10.f, 10.f);
+
+		GetViewFrustumBounds(OutFrustum, ViewMatrix * ProjectionMatrix, false);
+	}
+
+	// Get the view frustum of a local player. Fails if the player doesn't have a camera or a viewport.
+	bool GetViewFrustum(const APlayerController& PlayerController, const ULocalPlayer& LocalPlayer, FConvexVolume& OutFrustum)
+	{
+		if (!LocalPlayer.ViewportClient || !PlayerController.PlayerCameraManager)
+		{
+			return false;
+		}
+
+		// In split screen, players only get a part of the viewport.
+		FVector2D ViewportSize;
+		LocalPlayer.ViewportClient->GetViewportSize(ViewportSize);
+		ViewportSize *= LocalPlayer.Size;
+		if (ViewportSize.X <= 0.f || ViewportSize.Y <= 0.f)
+		{
+			return false;
+		}
+
+		FVector Location;
+		FRotator Rotation;
+		PlayerController.GetPlayerViewPoint(Location, Rotation);
+
+		GetViewFrustum(Location, Rotation, PlayerController.PlayerCameraManager->GetFOVAngle(), ViewportSize.X / ViewportSize.Y, OutFrustum);
+		return true;
+	}
+
+	// Get view frustums of all local players in a world. Fails if there are no local players, like in editor worlds, or
+	// if a view of any of them is unknown, in which case lines are not culled.
+	bool GetViewFrustums(const UWorld& World, TArray<FConvexVolume, TInlineAllocator<4>>& OutFrustums)
+	{
+		OutFrustums.Reset();
+
+		for (FConstPlayerControllerIterator It = World.GetPlayerControllerIterator(); It; ++It)
+		{
+			const APlayerController* PlayerController = It->Get();
+			if (const ULocalPlayer* LocalPlayer = PlayerController ? PlayerController->GetLocalPlayer() : nullptr)
+			{
+				if (!GetViewFrustum(*PlayerController, *LocalPlayer, OutFrustums.AddDefaulted_GetRef()))
+				{
+					OutFrustums.Reset();
+					return false;
+				}
+			}
+		}
+
+		return OutFrustums.Num() > 0;
+	}
+
+	ULineBatchComponent* GetLineBatcher(UWorld& World, uint8 DepthPriority)
+	{
+#if ENGINE_COMPATIBILITY_LEGACY_LINE_BATCHERS
+		return (DepthPriority == SDPG_Foreground) ? World.ForegroundLineBatcher : World.LineBatcher;
+#else
+		return World.GetLineBatcher((DepthPriority == SDPG_Foreground) ? UWorld::ELineBatcherType::Foreground : UWorld::ELineBatcherType::World);
+#endif
+	}
+}
+
+FImGuiDebugDrawBatcher::FImGuiDebugDrawBatcher()
+	: BenchmarkCommand(TEXT("ImGui.DebugDraw.Benchmark"),
+		TEXT("Measure CPU cost of recording, merging, culling and building ImGui debug lines without submitting them.\n")
+		TEXT("Usage: ImGui.DebugDraw.Benchmark [Lines=100000] [Tasks=8]"),
+		FConsoleCommandWithArgsDelegate::CreateRaw(this, &FImGuiDebugDrawBatcher::Benchmark))
+{
+#if ENGINE_COMPATIBILITY_WITH_WORLD_POST_ACTOR_TICK
+	FWorldDelegates::OnWorldPostActorTick.AddRaw(this, &FImGuiDebugDrawBatcher::OnWorldPostActorTick);
+#else
+	FWorldDelegates::OnWorldTickStart.AddRaw(this, &FImGuiDebugDrawBatcher::OnWorldTickStart);
+#endif
+}
+
+FImGuiDebugDrawBatcher::~FImGuiDebugDrawBatcher()
+{
+#if ENGINE_COMPATIBILITY_WITH_WORLD_POST_ACTOR_TICK
+	FWorldDelegates::OnWorldPostActorTick.RemoveAll(this);
+#else
+	FWorldDelegates::OnWorldTickStart.RemoveAll(this);
+#endif
+}
+
+void FImGuiDebugDrawBatcher::RecordLine(const void* Target, float Thickness, uint8 DepthPriority, const FImGuiDebugLine& Line)
+{
+	Record(Target, Thickness, DepthPriority, [&](FImGuiDebugBatch& Batch) { Batch.Lines.Add(Line); });
+}
+
+void FImGuiDebugDrawBatcher::RecordShape(const void* Target, float Thickness, uint8 DepthPriority, const FImGuiDebugShape& Shape)
+{
+	Record(Target, Thickness, DepthPriority, [&](FImGuiDebugBatch& Batch) { Batch.Shapes.Add(Shape); });
+}
+
+#if ENGINE_COMPATIBILITY_WITH_WORLD_POST_ACTOR_TICK
+void FImGuiDebugDrawBatcher::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	UpdateWorld(World);
+}
+#else
+void FImGuiDebugDrawBatcher::OnWorldTickStart(ELevelTick TickType, float DeltaSeconds)
+{
+	UpdateWorld(GWorld);
+}
+#endif // ENGINE_COMPATIBILITY_WITH_WORLD_POST_ACTOR_TICK
+
+void FImGuiDebugDrawBatcher::UpdateWorld(UWorld* World)
+{
+	if (World)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_ImGuiDebugDrawBatching);
+
+		if (LastMergeFrame != GFrameCounter)
+		{
+			LastMergeFrame = GFrameCounter;
+			DropStaleBatches();
+			MergeThreadBuffers();
+		}
+
+		SubmitLines(*World);
+	}
+}
+
+void FImGuiDebugDrawBatcher::MergeThreadBuffers()
+{
+	// After this, new calls record to batches of the other parity.
+	const uint32 Parity = Epoch.fetch_add(1) & 1;
+
+	FScopeLock Lock(&BuffersLock);
+
+	for (const TUniquePtr<FThreadBuffer>& Buffer : Buffers)
+	{
+		// Wait for calls that might have read the previous epoch.
+		while (Buffer->bRecording.load())
+		{
+			FPlatformProcess::YieldThread();
+		}
+
+		TArray<FImGuiDebugBatch>& Batches = Buffer->Batches[Parity];
+		for (int32 Index = Batches.Num() - 1; Index >= 0; Index--)
+		{
+			FImGuiDebugBatch& Batch = Batches[Index];
+
+			// Release batches that were not used since the last merge.
+			if (Batch.IsEmpty())
+			{
+				Batches.RemoveAtSwap(Index);
+				continue;
+			}
+
+			FImGuiDebugBatch& Pending = FindOrAddBatch(PendingBatches, Batch.Target, Batch.Thickness, Batch.DepthPriority);
+			if (Pending.IsEmpty())
+			{
+				// Swap arrays, so both sides keep their memory between frames.
+				Swap(Pending.Lines, Batch.Lines);
+				Swap(Pending.Shapes, Batch.Shapes);
+			}
+			else
+			{
+				Pending.Lines.Append(Batch.Lines);
+				Pending.Shapes.Append(Batch.Shapes);
+			}
+			Pending.bMerged = true;
+
+			Batch.Lines.Reset();
+			Batch.Shapes.Reset();
+		}
+
+		// Removing batches invalidates the cache, but this parity is not used until the next merge.
+		Buffer->LastBatch[Parity] = INDEX_NONE;
+	}
+}
+
+void FImGuiDebugDrawBatcher::DropStaleBatches()
+{
+	for (int32 Index = PendingBatches.Num() - 1; Index >= 0; Index--)
+	{
+		FImGuiDebugBatch& Batch = PendingBatches[Index];
+		if (Batch.bMerged)
+		{
+			Batch.Lines.Reset();
+			Batch.Shapes.Reset();
+			Batch.bMerged = false;
+		}
+		else
+		{
+			PendingBatches.RemoveAtSwap(Index);
+		}
+	}
+}
+
+int32 FImGuiDebugDrawBatcher::BuildLines(const void* Target, uint8 DepthPriority, TArrayView<const FConvexVolume> Frustums, float LifeTime, TArray<FBatchedLine>& OutLines)
+{
+	int32 NumCulled = 0;
+
+	for (FImGuiDebugBatch& Batch : PendingBatches)
+	{
+		if (Batch.Target != Target || Batch.DepthPriority != DepthPriority)
+		{
+			continue;
+		}
+
+		const float Thickness = Batch.Thickness;
+		OutLines.Reserve(OutLines.Num() + Batch.Lines.Num());
+
+		for (const FImGuiDebugLine& Line : Batch.Lines)
+		{
+			const FVector Start{ Line.Start };
+			const FVector End{ Line.End };
+			if (IsOutside(Frustums, Start, End))
+			{
+				NumCulled++;
+			}
+			else
+			{
+				OutLines.Emplace(Start, End, FLinearColor(Line.Color), LifeTime, Thickness, DepthPriority);
+			}
+		}
+
+		for (const FImGuiDebugShape& Shape : Batch.Shapes)
+		{
+			if (IsOutside(Frustums, FVector{ Shape.Center }, GetBoundingRadius(Shape)))
+			{
+				NumCulled += GetNumLines(Shape);
+			}
+			else
+			{
+				const FLinearColor Color{ Shape.Color };
+				TessellateShape(Shape, [&](const FVector& Start, const FVector& End)
+				{
+					OutLines.Emplace(Start, End, Color, LifeTime, Thickness, DepthPriority);
+				});
+			}
+		}
+
+		Batch.Lines.Reset();
+		Batch.Shapes.Reset();
+	}
+
+	return NumCulled;
+}
+
+void FImGuiDebugDrawBatcher::SubmitLines(UWorld& World)
+{
+	// Lines are drawn in views of all local players, so they are only culled if they are outside of all of them.
+	TArray<FConvexVolume, TInlineAllocator<4>> Frustums;
+	GetViewFrustums(World, Frustums);
+
+	for (const ESceneDepthPriorityGroup DepthPriority : { SDPG_World, SDPG_Foreground })
+	{
+		if (ULineBatchComponent* LineBatcher = GetLineBatcher(World, DepthPriority))
+		{
+			IMGUI_TRACK_CONTAINER_GROWTH(BatchedLines);
+
+			// Non-persistent lines use the default lifetime, like in DrawDebugLine.
+			BatchedLines.Reset();
+			const int32 NumCulled = BuildLines(&World, DepthPriority, Frustums, LineBatcher->DefaultLifeTime, BatchedLines);
+
+			// One call for all lines, so the line batcher updates its render state only once.
+			if (BatchedLines.Num() > 0)
+			{
+				LineBatcher->DrawLines(BatchedLines);
+			}
+
+			INC_DWORD_STAT_BY(STAT_ImGuiDebugLines, BatchedLines.Num());
+			INC_DWORD_STAT_BY(STAT_ImGuiCulledDebugLines, NumCulled);
+		}
+	}
+
+	BatchedLines.Reset();
+}
+
+void FImGuiDebugDrawBatcher::Benchmark(const TArray<FString>& Args)
+{
+	const int32 NumLines = (Args.Num() > 0) ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100000;
+	const int32 NumTasks = (Args.Num() > 1) ? FMath::Clamp(FCString::Atoi(*Args[1]), 1, 64) : 8;
+
+	// Random lines around a camera at the origin, so part of them is culled.
+	TArray<FImGuiDebugLine> Lines;
+	Lines.Reserve(NumLines);
+	FRandomStream Random(NumLines);
+	for (int32 Index = 0; Index < NumLines; Index++)
+	{
+		const FVector Start = Random.GetUnitVector() * Random.FRandRange(100.f, 10000.f);
+		const FVector End = Start + Random.GetUnitVector() * 100.f;
+		Lines.Add({ FImGuiDebugVector{ Start }, FImGuiDebugVector{ End }, FColor::Green });
+	}
+
+	// Lines are recorded for a target that is not a world, so they are never submitted. Merge also moves lines recorded
+	// for worlds, but since it happens out of the frame order, those are dropped.
+	static const uint8 BenchmarkTarget = 0;
+
+	const double RecordStartTime = FPlatformTime::Seconds();
+	ParallelFor(NumTasks, [&](int32 TaskIndex)
+	{
+		const int32 First = static_cast<int32>(static_cast<int64>(TaskIndex) * NumLines / NumTasks);
+		const int32 Last = static_cast<int32>(static_cast<int64>(TaskIndex + 1) * NumLines / NumTasks);
+		for (int32 Index = First; Index < Last; Index++)
+		{
+			RecordLine(&BenchmarkTarget, 0.f, SDPG_World, Lines[Index]);
+		}
+	});
+
+	const double MergeStartTime = FPlatformTime::Seconds();
+	MergeThreadBuffers();
+
+	const double BuildStartTime = FPlatformTime::Seconds();
+	FConvexVolume Frustum;
+	GetViewFrustum(FVector::ZeroVector, FRotator::ZeroRotator, 90.f, 16.f / 9.f, Frustum);
+	const int32 NumCulled = BuildLines(&BenchmarkTarget, SDPG_World, MakeArrayView(&Frustum, 1), 0.f, BatchedLines);
+	const int32 NumBuilt = BatchedLines.Num();
+
+	const double EndTime = FPlatformTime::Seconds();
+	BatchedLines.Reset();
+
+	UE_LOG(LogImGuiDebugDraw, Display, TEXT("Debug draw benchmark: %d lines in %d tasks, record %.3f ms, merge %.3f ms, cull and build %.3f ms (%d culled, %d built), %.1f M lines/s. Recorded line: %d bytes, batched line: %d bytes."),
+		NumLines, NumTasks, (MergeStartTime - RecordStartTime) * 1000.0, (BuildStartTime - MergeStartTime) * 1000.0,
+		(EndTime - BuildStartTime) * 1000.0, NumCulled, NumBuilt, NumLines / (EndTime - RecordStartTime) / 1000000.0,
+		static_cast<int32>(sizeof(FImGuiDebugLine)), static_cast<int32>(sizeof(FBatchedLine)));
+}
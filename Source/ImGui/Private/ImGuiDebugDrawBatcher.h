@@ -0,0 +1,140 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "VersionCompatibility.h"
+
+#include <CoreMinimal.h>
+#include <Components/LineBatchComponent.h>
+#include <Engine/EngineBaseTypes.h>
+#include <HAL/IConsoleManager.h>
+
+
+class FConvexVolume;
+class UWorld;
+
+#if ENGINE_COMPATIBILITY_LEGACY_VECTOR3F
+using FImGuiDebugVector = FVector;
+using FImGuiDebugQuat = FQuat;
+#else
+using FImGuiDebugVector = FVector3f;
+using FImGuiDebugQuat = FQuat4f;
+#endif // ENGINE_COMPATIBILITY_LEGACY_VECTOR3F
+
+// Line in the compact form in which it is recorded. Thickness and depth priority are shared by all lines in a batch.
+struct FImGuiDebugLine
+{
+	FImGuiDebugVector Start;
+	FImGuiDebugVector End;
+	FColor Color;
+};
+
+enum class EImGuiDebugShape : uint8
+{
+	Box,
+	Sphere
+};
+
+// Shape recorded as parameters and tessellated into lines only if it passes culling. For spheres, radius is stored in
+// the X component of the extent.
+struct FImGuiDebugShape
+{
+	FImGuiDebugVector Center;
+	FImGuiDebugVector Extent;
+	FImGuiDebugQuat Rotation;
+	FColor Color;
+	EImGuiDebugShape Type;
+	uint8 Segments;
+};
+
+// Lines and shapes with the same target and style.
+struct FImGuiDebugBatch
+{
+	bool Matches(const void* InTarget, float InThickness, uint8 InDepthPriority) const
+	{
+		return Target == InTarget && Thickness == InThickness && DepthPriority == InDepthPriority;
+	}
+
+	bool IsEmpty() const { return Lines.Num() == 0 && Shapes.Num() == 0; }
+
+	// Target is only used as a key and never dereferenced, so it is safe to keep it after the world is destroyed.
+	const void* Target = nullptr;
+	float Thickness = 0.f;
+	uint8 DepthPriority = 0;
+
+	// Whether a pending batch received anything since the last frame (pending batches that didn't are released).
+	bool bMerged = false;
+
+	TArray<FImGuiDebugLine> Lines;
+	TArray<FImGuiDebugShape> Shapes;
+};
+
+// Batches recordings of FImGuiDebugDraw and submits them to world line batchers.
+//
+// Every thread records into its own buffer, which has two sets of batches indexed by parity of a global epoch. Recording
+// thread marks its buffer as busy, reads the epoch and appends to batches of that parity. Once per frame, the game
+// thread advances the epoch, waits until buffers are not busy (which can only take until calls that started before the
+// epoch changed are finished) and moves batches of the previous parity to pending batches. Recording threads never wait
+// and only take a lock once, to register their buffers.
+class FImGuiDebugDrawBatcher
+{
+public:
+
+	FImGuiDebugDrawBatcher();
+	~FImGuiDebugDrawBatcher();
+
+	FImGuiDebugDrawBatcher(const FImGuiDebugDrawBatcher&) = delete;
+	FImGuiDebugDrawBatcher& operator=(const FImGuiDebugDrawBatcher&) = delete;
+
+	FImGuiDebugDrawBatcher(FImGuiDebugDrawBatcher&&) = delete;
+	FImGuiDebugDrawBatcher& operator=(FImGuiDebugDrawBatcher&&) = delete;
+
+	// Record a line or a shape in the buffer of the calling thread. Can be called from any thread.
+	// @param Target - Key identifying where lines should be drawn (usually a world)
+	// @param Thickness - Line thickness
+	// @param DepthPriority - Depth priority group (SDPG_World or SDPG_Foreground)
+	static void RecordLine(const void* Target, float Thickness, uint8 DepthPriority, const FImGuiDebugLine& Line);
+	static void RecordShape(const void* Target, float Thickness, uint8 DepthPriority, const FImGuiDebugShape& Shape);
+
+private:
+
+#if ENGINE_COMPATIBILITY_WITH_WORLD_POST_ACTOR_TICK
+	void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+#else
+	void OnWorldTickStart(ELevelTick TickType, float DeltaSeconds);
+#endif
+
+	// Merge thread buffers if it is the first world update in this frame and submit lines of the world.
+	void UpdateWorld(UWorld* World);
+
+	// Move batches recorded by all threads since the last merge to pending batches.
+	void MergeThreadBuffers();
+
+	// Drop content of pending batches that were not submitted, because their targets didn't tick, and release batches
+	// that were not used in the last frame.
+	void DropStaleBatches();
+
+	// Cull and tessellate pending batches of a target into batched lines and reset those batches.
+	// @param Target - Target of batches to build
+	// @param DepthPriority - Depth priority of batches to build
+	// @param Frustums - Frustums of views in which lines are drawn (lines outside of all of them are culled) or empty to
+	//     skip culling
+	// @param LifeTime - Lifetime of batched lines
+	// @param OutLines - Array to which batched lines are added
+	// @returns Number of lines culled
+	int32 BuildLines(const void* Target, uint8 DepthPriority, TArrayView<const FConvexVolume> Frustums, float LifeTime, TArray<FBatchedLine>& OutLines);
+
+	void SubmitLines(UWorld& World);
+
+	void Benchmark(const TArray<FString>& Args);
+
+	// Batches merged from thread buffers and waiting to be submitted.
+	TArray<FImGuiDebugBatch> PendingBatches;
+
+	// Reusable buffer for lines submitted to line batchers.
+	TArray<FBatchedLine> BatchedLines;
+
+	uint64 LastMergeFrame = 0;
+
+	FAutoConsoleCommand BenchmarkCommand;
+};
@@ -2,9 +2,34 @@
 
 #include "ImGuiDelegates.h"
 #include "ImGuiDelegatesContainer.h"
+#include "ImGuiModuleDebug.h"
+#include "Utilities/WorldContextIndex.h"
 
 #include <Engine/World.h>
 
+#include <imgui_internal.h>
+
+#include <string>
+
+
+namespace
+{
+	// Whether the window was drawn with its items in the previous frame. Should be called before the window is begun.
+	bool WasWindowVisible(const char* WindowName)
+	{
+		// Windows that don't exist yet need data for their first frame.
+		const ImGuiWindow* Window = ImGui::FindWindowByName(WindowName);
+		if (!Window)
+		{
+			return true;
+		}
+
+		// Items are skipped in collapsed windows and in windows hidden by the context (e.g. when they are outside of
+		// the visible part of the canvas or covered by opaque windows).
+		return Window->WasActive && !Window->SkipItems;
+	}
+}
+
 
 FSimpleMulticastDelegate& FImGuiDelegates::OnWorldEarlyDebug()
 {
@@ -35,3 +60,47 @@ FSimpleMulticastDelegate& FImGuiDelegates::OnMultiContextDebug()
 {
 	return FImGuiDelegatesContainer::Get().OnMultiContextDebug();
 }
+
+FDelegateHandle FImGuiDelegates::AddWorldDebugPanel(const FString& WindowName, FSimpleDelegate Gather, FSimpleDelegate Draw)
+{
+	return AddWorldDebugPanel(GWorld, WindowName, MoveTemp(Gather), MoveTemp(Draw));
+}
+
+FDelegateHandle FImGuiDelegates::AddWorldDebugPanel(UWorld* World, const FString& WindowName, FSimpleDelegate Gather, FSimpleDelegate Draw)
+{
+	return OnWorldDebug(World).AddLambda([Name = std::string(TCHAR_TO_UTF8(*WindowName)), Gather = MoveTemp(Gather), Draw = MoveTemp(Draw)]()
+	{
+		if (WasWindowVisible(Name.c_str()))
+		{
+			Gather.ExecuteIfBound();
+		}
+		else
+		{
+			INC_DWORD_STAT(STAT_ImGuiSkippedPanels);
+		}
+
+		Draw.ExecuteIfBound();
+	});
+}
+
+int32 FImGuiDelegates::AddParallelPanel(const UWorld* World, const FString& WindowName, TFunction<void()> Draw, TFunction<void()> Snapshot)
+{
+	checkf(IsInGameThread(), TEXT("Parallel panels can only be added on the game thread."));
+	checkf(Draw, TEXT("Null draw function for parallel panel '%s'."), *WindowName);
+
+	TSharedRef<FImGuiParallelPanel> Panel = MakeShared<FImGuiParallelPanel>();
+	Panel->WorldContextIndex = Utilities::GetWorldContextIndex(World);
+	Panel->bAllWorlds = (World == nullptr);
+	Panel->WindowName = TCHAR_TO_UTF8(*WindowName);
+	Panel->Draw = MoveTemp(Draw);
+	Panel->Snapshot = MoveTemp(Snapshot);
+
+	return FImGuiDelegatesContainer::Get().AddParallelPanel(MoveTemp(Panel));
+}
+
+void FImGuiDelegates::RemoveParallelPanel(int32 PanelId)
+{
+	checkf(IsInGameThread(), TEXT("Parallel panels can only be removed on the game thread."));
+
+	FImGuiDelegatesContainer::Get().RemoveParallelPanel(PanelId);
+}
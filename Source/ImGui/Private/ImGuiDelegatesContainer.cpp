@@ -79,10 +79,17 @@ int32 FImGuiDelegatesContainer::GetContextIndex(UWorld* World)
 	return Utilities::GetWorldContextIndex(*World);
 }
 
+int32 FImGuiDelegatesContainer::AddParallelPanel(TSharedRef<const FImGuiParallelPanel> Panel)
+{
+	ParallelPanels.Add(++LastParallelPanelId, MoveTemp(Panel));
+	return LastParallelPanelId;
+}
+
 void FImGuiDelegatesContainer::Clear()
 {
 	WorldEarlyDebugDelegates.Empty();
 	WorldDebugDelegates.Empty();
 	MultiContextEarlyDebugDelegate.Clear();
 	MultiContextDebugDelegate.Clear();
+	ParallelPanels.Empty();
 }
@@ -4,12 +4,29 @@
 
 #include <Containers/Map.h>
 #include <Delegates/Delegate.h>
+#include <Templates/Function.h>
+#include <Templates/SharedPointer.h>
+
+#include <string>
 
 
 #if WITH_EDITOR
 struct FImGuiDelegatesContainerHandle;
 #endif
 
+// Panel registered with FImGuiDelegates::AddParallelPanel.
+struct FImGuiParallelPanel
+{
+	// Index of the world whose context shows the panel (ignored if the panel is shown in all contexts).
+	int32 WorldContextIndex = 0;
+	bool bAllWorlds = false;
+
+	std::string WindowName;
+
+	TFunction<void()> Draw;
+	TFunction<void()> Snapshot;
+};
+
 struct FImGuiDelegatesContainer
 {
 public:
@@ -43,6 +60,16 @@ public:
 	// Get delegate to ImGui multi-context debug event.
 	FSimpleMulticastDelegate& OnMultiContextDebug() { return MultiContextDebugDelegate; }
 
+	// Add a parallel panel and get its id.
+	int32 AddParallelPanel(TSharedRef<const FImGuiParallelPanel> Panel);
+
+	// Remove a parallel panel (does nothing if the panel was already removed).
+	void RemoveParallelPanel(int32 PanelId) { ParallelPanels.Remove(PanelId); }
+
+	// Get registered parallel panels mapped by their ids. Panels are shared, so tasks building them can keep them alive
+	// after they are removed.
+	const TMap<int32, TSharedRef<const FImGuiParallelPanel>>& GetParallelPanels() const { return ParallelPanels; }
+
 private:
 
 	int32 GetContextIndex(UWorld* World);
@@ -53,4 +80,6 @@ private:
 	TMap<int32, FSimpleMulticastDelegate> WorldDebugDelegates;
 	FSimpleMulticastDelegate MultiContextEarlyDebugDelegate;
 	FSimpleMulticastDelegate MultiContextDebugDelegate;
+	TMap<int32, TSharedRef<const FImGuiParallelPanel>> ParallelPanels;
+	int32 LastParallelPanelId = 0;
 };
@@ -2,6 +2,31 @@
 
 #include "ImGuiDrawData.h"
 
+#include "ImGuiModuleDebug.h"
+
+
+namespace
+{
+	template<typename T>
+	bool IsSameData(const ImVector<T>& A, const ImVector<T>& B)
+	{
+		return A.Size == B.Size && FMemory::Memcmp(A.Data, B.Data, A.size_in_bytes()) == 0;
+	}
+
+	// ImVector only grows, so to release unused capacity we need to replace it with a copy.
+	template<typename T>
+	void ShrinkToFit(ImVector<T>& Vector)
+	{
+		if (Vector.Capacity > Vector.Size)
+		{
+			ImVector<T> Copy = Vector;
+			Vector.swap(Copy);
+		}
+	}
+
+	// Revisions are unique across all lists, so lists that swap positions in the draw data are never mistaken.
+	uint32 LastRevision = 0;
+}
 
 #if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
 void FImGuiDrawList::CopyVertexData(TArray<FSlateVertex>& OutVertexBuffer, const FTransform2D& Transform, const FSlateRotatedRect& VertexClippingRect) const
@@ -41,23 +66,96 @@ void FImGuiDrawList::CopyVertexData(TArray<FSlateVertex>& OutVertexBuffer, const
 	}
 }
 
-void FImGuiDrawList::CopyIndexData(TArray<SlateIndex>& OutIndexBuffer, const int32 StartIndex, const int32 NumElements) const
+void FImGuiDrawList::CopyIndexData(TArray<SlateIndex>& OutIndexBuffer, const int32 StartIndex, const int32 NumElements, const uint32 VtxOffset) const
 {
 	// Reset buffer.
 	OutIndexBuffer.SetNumUninitialized(NumElements, false);
 
 	// Copy elements (slow copy because of different sizes of ImDrawIdx and SlateIndex and because SlateIndex can
-	// have different size on different platforms).
+	// have different size on different platforms). Vertex offset allows 16-bit ImGui indices to address vertex buffers
+	// larger than 64K.
 	for (int i = 0; i < NumElements; i++)
 	{
-		OutIndexBuffer[i] = ImGuiIndexBuffer[StartIndex + i];
+		OutIndexBuffer[i] = ImGuiIndexBuffer[StartIndex + i] + VtxOffset;
 	}
 }
 
 void FImGuiDrawList::TransferDrawData(ImDrawList& Src)
 {
+	// Comparing is much cheaper than converting, so it pays off when content doesn't change between frames.
+	const bool bChanged = !IsSameData(Src.VtxBuffer, ImGuiVertexBuffer) || !IsSameData(Src.IdxBuffer, ImGuiIndexBuffer)
+		|| !IsSameData(Src.CmdBuffer, ImGuiCommandBuffer);
+	if (bChanged)
+	{
+		Revision = ++LastRevision;
+	}
+
 	// Move data from source to this list.
 	Src.CmdBuffer.swap(ImGuiCommandBuffer);
 	Src.IdxBuffer.swap(ImGuiIndexBuffer);
 	Src.VtxBuffer.swap(ImGuiVertexBuffer);
 }
+
+void FImGuiDrawList::Shrink()
+{
+	ShrinkToFit(ImGuiCommandBuffer);
+	ShrinkToFit(ImGuiIndexBuffer);
+	ShrinkToFit(ImGuiVertexBuffer);
+}
+
+#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+const TArray<FSlateVertex>& FImGuiVertexCache::GetVertices(int32 Slot, const FImGuiDrawList& DrawList, const FTransform2D& Transform, const FSlateRect& ClippingRect)
+#else
+const TArray<FSlateVertex>& FImGuiVertexCache::GetVertices(int32 Slot, const FImGuiDrawList& DrawList, const FTransform2D& Transform)
+#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+{
+	if (Slot >= Entries.Num())
+	{
+		Entries.SetNum(Slot + 1);
+	}
+
+	FEntry& Entry = Entries[Slot];
+
+#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+	const bool bUpToDate = Entry.bValid && Entry.Revision == DrawList.GetRevision() && Entry.Transform == Transform
+		&& Entry.ClippingRect == ClippingRect;
+#else
+	const bool bUpToDate = Entry.bValid && Entry.Revision == DrawList.GetRevision() && Entry.Transform == Transform;
+#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+
+	if (!bUpToDate)
+	{
+#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+		DrawList.CopyVertexData(Entry.Vertices, Transform, FSlateRotatedRect{ ClippingRect });
+		Entry.ClippingRect = ClippingRect;
+#else
+		DrawList.CopyVertexData(Entry.Vertices, Transform);
+#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+
+		Entry.Revision = DrawList.GetRevision();
+		Entry.Transform = Transform;
+		Entry.bValid = true;
+
+		INC_DWORD_STAT_BY(STAT_ImGuiConvertedVertices, Entry.Vertices.Num());
+	}
+
+	return Entry.Vertices;
+}
+
+void FImGuiVertexCache::Trim(int32 NumSlots)
+{
+	if (Entries.Num() > NumSlots)
+	{
+		Entries.SetNum(NumSlots);
+	}
+}
+
+SIZE_T FImGuiVertexCache::GetAllocatedSize() const
+{
+	SIZE_T Size = Entries.GetAllocatedSize();
+	for (const FEntry& Entry : Entries)
+	{
+		Size += Entry.Vertices.GetAllocatedSize();
+	}
+	return Size;
+}
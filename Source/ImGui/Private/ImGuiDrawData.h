@@ -17,6 +17,7 @@ struct FImGuiDrawCommand
 	FSlateRect ClippingRect;
 	TextureIndex TextureId;
 	unsigned IdxOffset;
+	unsigned VtxOffset;
 };
 
 // Wraps raw ImGui draw list data in utilities that transform them for Slate.
@@ -27,6 +28,12 @@ public:
 	// Get the number of draw commands in this list.
 	FORCEINLINE int NumCommands() const { return ImGuiCommandBuffer.Size; }
 
+	// Get the number of vertices in this list.
+	FORCEINLINE int NumVertices() const { return ImGuiVertexBuffer.Size; }
+
+	// Get the number of indices in this list.
+	FORCEINLINE int NumIndices() const { return ImGuiIndexBuffer.Size; }
+
 	// Get the draw command by number.
 	// @param CommandNb - Number of draw command
 	// @param Transform - Transform to apply to clipping rectangle
@@ -35,7 +42,7 @@ public:
 	{
 		const ImDrawCmd& ImGuiCommand = ImGuiCommandBuffer[CommandNb];
 		return { ImGuiCommand.ElemCount, TransformRect(Transform, ImGuiInterops::ToSlateRect(ImGuiCommand.ClipRect)),
-			ImGuiInterops::ToTextureIndex(ImGuiCommand.TextureId), ImGuiCommand.IdxOffset };
+			ImGuiInterops::ToTextureIndex(ImGuiCommand.TextureId), ImGuiCommand.IdxOffset, ImGuiCommand.VtxOffset };
 	}
 
 #if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
@@ -56,14 +63,84 @@ public:
 	// @param OutIndexBuffer - Destination buffer
 	// @param StartIndex - Start copying source data starting from this index
 	// @param NumElements - How many elements we want to copy
-	void CopyIndexData(TArray<SlateIndex>& OutIndexBuffer, const int32 StartIndex, const int32 NumElements) const;
+	// @param VtxOffset - Offset added to all copied indices (see ImGuiBackendFlags_RendererHasVtxOffset)
+	void CopyIndexData(TArray<SlateIndex>& OutIndexBuffer, const int32 StartIndex, const int32 NumElements, const uint32 VtxOffset = 0) const;
 
 	// Transfers data from ImGui source list to this object. Leaves source cleared.
 	void TransferDrawData(ImDrawList& Src);
 
+	// Release unused capacity of buffers. Buffers are swapped with ImGui lists in every transfer, so this is only useful
+	// after a drop in the content size.
+	void Shrink();
+
+	// Get the number identifying content of this list. It only changes when transferred data are different than before,
+	// so data converted from this list can be reused as long as it stays the same.
+	FORCEINLINE uint32 GetRevision() const { return Revision; }
+
+	// Get the index of the world which created this list in a shared context or INDEX_NONE, if this list should be
+	// drawn in all viewports.
+	FORCEINLINE int32 GetWorldContextIndex() const { return WorldContextIndex; }
+
+	// Set the index of the world which created this list in a shared context.
+	FORCEINLINE void SetWorldContextIndex(int32 Index) { WorldContextIndex = Index; }
+
+	// Whether this list should be drawn in a viewport of the world with the given context index.
+	FORCEINLINE bool IsVisibleInWorld(int32 Index) const { return WorldContextIndex == INDEX_NONE || WorldContextIndex == Index; }
+
 private:
 
 	ImVector<ImDrawCmd> ImGuiCommandBuffer;
 	ImVector<ImDrawIdx> ImGuiIndexBuffer;
 	ImVector<ImDrawVert> ImGuiVertexBuffer;
+
+	int32 WorldContextIndex = INDEX_NONE;
+
+	uint32 Revision = 0;
+};
+
+// Keeps vertices of draw lists converted for Slate, so they don't need to be converted again while lists and transforms
+// don't change (e.g. when only the mouse moves).
+class FImGuiVertexCache
+{
+public:
+
+#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+	// Get vertices of a draw list converted for Slate, converting them only if needed.
+	// @param Slot - Slot in the cache for this list (typically its index in the draw data)
+	// @param DrawList - Draw list with source vertices
+	// @param Transform - Transform to apply to all vertices
+	// @param ClippingRect - Clipping rectangle for transformed Slate vertices
+	// @returns Converted vertices, valid until the next call
+	const TArray<FSlateVertex>& GetVertices(int32 Slot, const FImGuiDrawList& DrawList, const FTransform2D& Transform, const FSlateRect& ClippingRect);
+#else
+	// Get vertices of a draw list converted for Slate, converting them only if needed.
+	// @param Slot - Slot in the cache for this list (typically its index in the draw data)
+	// @param DrawList - Draw list with source vertices
+	// @param Transform - Transform to apply to all vertices
+	// @returns Converted vertices, valid until the next call
+	const TArray<FSlateVertex>& GetVertices(int32 Slot, const FImGuiDrawList& DrawList, const FTransform2D& Transform);
+#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+
+	// Release slots above the given number (slots of lists that are no longer drawn).
+	void Trim(int32 NumSlots);
+
+	// Release all cached data.
+	void Empty() { Entries.Empty(); }
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+
+	struct FEntry
+	{
+		uint32 Revision = 0;
+		FTransform2D Transform;
+#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+		FSlateRect ClippingRect;
+#endif
+		TArray<FSlateVertex> Vertices;
+		bool bValid = false;
+	};
+
+	TArray<FEntry> Entries;
 };
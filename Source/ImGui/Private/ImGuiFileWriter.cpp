@@ -0,0 +1,422 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiFileWriter.h"
+
+#include "VersionCompatibility.h"
+
+#include <Containers/StringConv.h>
+#include <GenericPlatform/GenericPlatformFile.h>
+#include <HAL/Event.h>
+#include <HAL/FileManager.h>
+#include <HAL/IConsoleManager.h>
+#include <HAL/PlatformFileManager.h>
+#include <HAL/PlatformProcess.h>
+#include <HAL/PlatformTime.h>
+#include <HAL/RunnableThread.h>
+#include <Misc/Paths.h>
+#include <Misc/ScopeLock.h>
+#include <Serialization/Archive.h>
+
+#include <imgui_internal.h>
+
+
+DEFINE_LOG_CATEGORY_STATIC(LogImGuiFiles, Warning, All);
+DEFINE_LOG_CATEGORY_STATIC(LogImGuiTTY, Log, All);
+
+namespace CVars
+{
+	TAutoConsoleVariable<int> MaxPendingFileData(TEXT("ImGui.Files.MaxPendingKB"), 4096,
+		TEXT("Maximum size in KB of ImGui log and settings data waiting to be written to files. When exceeded, writes\n")
+		TEXT("wait until pending data is written."),
+		ECVF_Default);
+}
+
+namespace
+{
+	// Size of data buffered in file handles before it is passed to the writer.
+	constexpr int32 FileChunkSize = 64 * 1024;
+
+	TUniquePtr<FImGuiFileWriter>& GetWriterInstance()
+	{
+		static TUniquePtr<FImGuiFileWriter> Instance;
+		return Instance;
+	}
+
+	FORCEINLINE int64 ToMicroseconds(double Seconds)
+	{
+		return static_cast<int64>(Seconds * 1000000.0);
+	}
+
+	FORCEINLINE double ToSeconds(int64 Microseconds)
+	{
+		return Microseconds / 1000000.0;
+	}
+}
+
+FImGuiFileWriter& FImGuiFileWriter::Get()
+{
+	TUniquePtr<FImGuiFileWriter>& Instance = GetWriterInstance();
+	if (!Instance)
+	{
+		Instance.Reset(new FImGuiFileWriter());
+	}
+	return *Instance;
+}
+
+void FImGuiFileWriter::Shutdown()
+{
+	GetWriterInstance().Reset();
+}
+
+FImGuiFileWriter::FImGuiFileWriter()
+{
+	if (FPlatformProcess::SupportsMultithreading())
+	{
+		WorkEvent = FPlatformProcess::GetSynchEventFromPool();
+		Thread = FRunnableThread::Create(this, TEXT("ImGuiFileWriter"), 0, TPri_BelowNormal);
+	}
+}
+
+FImGuiFileWriter::~FImGuiFileWriter()
+{
+	if (Thread)
+	{
+		// Stopping thread processes remaining requests before it exits.
+		Thread->Kill(true);
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	if (WorkEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+		WorkEvent = nullptr;
+	}
+
+	// Process what is left, if we don't have a thread or something was queued during shutdown.
+	ProcessRequests();
+}
+
+int32 FImGuiFileWriter::Open(const FString& Path, bool bAppend)
+{
+	// Earlier writes or a pending close of the same file need to be completed before it is opened again.
+	Flush();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(Path));
+
+	IFileHandle* Handle = PlatformFile.OpenWrite(*Path, bAppend);
+	if (!Handle)
+	{
+		UE_LOG(LogImGuiFiles, Warning, TEXT("Couldn't open '%s' for writing."), *Path);
+		return INDEX_NONE;
+	}
+
+	const int32 FileId = NextFileId++;
+	{
+		FScopeLock Lock(&ProcessingCriticalSection);
+		Files.Add(FileId, TUniquePtr<IFileHandle>(Handle));
+	}
+	return FileId;
+}
+
+void FImGuiFileWriter::Write(int32 FileId, TArray<uint8>&& Data)
+{
+	if (FileId == INDEX_NONE || Data.Num() == 0)
+	{
+		return;
+	}
+
+	// Wait if there is too much pending data. Large writes are accepted when nothing else is pending.
+	const int64 MaxPendingBytes = CVars::MaxPendingFileData.GetValueOnAnyThread() * 1024ll;
+	if (Thread && PendingBytes.GetValue() > 0 && PendingBytes.GetValue() + Data.Num() > MaxPendingBytes)
+	{
+		const double StallStart = FPlatformTime::Seconds();
+		while (PendingBytes.GetValue() > 0 && PendingBytes.GetValue() + Data.Num() > MaxPendingBytes)
+		{
+			FPlatformProcess::SleepNoStats(0.0005f);
+		}
+		StallTime.Add(ToMicroseconds(FPlatformTime::Seconds() - StallStart));
+	}
+
+	PendingBytes.Add(Data.Num());
+	Enqueue({ FileId, EOperation::Write, MoveTemp(Data), FPlatformTime::Seconds() });
+}
+
+void FImGuiFileWriter::Close(int32 FileId)
+{
+	if (FileId != INDEX_NONE)
+	{
+		Enqueue({ FileId, EOperation::Close, {}, FPlatformTime::Seconds() });
+	}
+}
+
+void FImGuiFileWriter::Flush()
+{
+	if (Thread)
+	{
+		while (PendingRequests.GetValue() > 0)
+		{
+			WorkEvent->Trigger();
+			FPlatformProcess::SleepNoStats(0.0005f);
+		}
+	}
+	else
+	{
+		ProcessRequests();
+	}
+}
+
+FImGuiFileWriter::FStats FImGuiFileWriter::GetStats() const
+{
+	FStats Stats;
+	Stats.BytesWritten = BytesWritten.GetValue();
+	Stats.PendingBytes = PendingBytes.GetValue();
+	Stats.LastFlushLatency = ToSeconds(LastFlushLatency.GetValue());
+	Stats.MaxFlushLatency = ToSeconds(MaxFlushLatency.GetValue());
+	Stats.StallTime = ToSeconds(StallTime.GetValue());
+	return Stats;
+}
+
+void FImGuiFileWriter::Enqueue(FRequest&& Request)
+{
+	PendingRequests.Increment();
+	Requests.Enqueue(MoveTemp(Request));
+
+	if (Thread)
+	{
+		WorkEvent->Trigger();
+	}
+	else
+	{
+		ProcessRequests();
+	}
+}
+
+void FImGuiFileWriter::ProcessRequests()
+{
+	FScopeLock Lock(&ProcessingCriticalSection);
+
+	FRequest Request;
+	while (Requests.Dequeue(Request))
+	{
+		ProcessRequest(Request);
+		PendingRequests.Decrement();
+	}
+}
+
+void FImGuiFileWriter::ProcessRequest(FRequest& Request)
+{
+	switch (Request.Operation)
+	{
+	case EOperation::Write:
+	{
+		if (TUniquePtr<IFileHandle>* Handle = Files.Find(Request.FileId))
+		{
+			if ((*Handle)->Write(Request.Data.GetData(), Request.Data.Num()))
+			{
+				BytesWritten.Add(Request.Data.Num());
+			}
+		}
+
+		PendingBytes.Subtract(Request.Data.Num());
+
+		const int64 Latency = ToMicroseconds(FPlatformTime::Seconds() - Request.QueueTime);
+		LastFlushLatency.Set(Latency);
+		if (Latency > MaxFlushLatency.GetValue())
+		{
+			MaxFlushLatency.Set(Latency);
+		}
+		break;
+	}
+
+	case EOperation::Close:
+		Files.Remove(Request.FileId);
+		break;
+	}
+}
+
+uint32 FImGuiFileWriter::Run()
+{
+	while (!bStopping)
+	{
+		WorkEvent->Wait();
+		ProcessRequests();
+	}
+
+	ProcessRequests();
+	return 0;
+}
+
+void FImGuiFileWriter::Stop()
+{
+	bStopping = true;
+	WorkEvent->Trigger();
+}
+
+//----------------------------------------------------------------------------------------------------
+// ImGui file functions
+//----------------------------------------------------------------------------------------------------
+
+// Handle for files opened by ImGui. Files opened for reading are read synchronously, while writes are buffered and
+// passed to the file writer. TTY output is buffered until the end of a line and printed to the log.
+struct FImGuiFile
+{
+	TUniquePtr<FArchive> Reader;
+	TArray<uint8> Buffer;
+	int32 WriterFileId = INDEX_NONE;
+	bool bIsTTY = false;
+
+	void FlushBuffer()
+	{
+		if (Buffer.Num() > 0)
+		{
+			FImGuiFileWriter::Get().Write(WriterFileId, MoveTemp(Buffer));
+			Buffer.Reset();
+		}
+	}
+
+	void PrintLines(bool bFlushAll)
+	{
+		int32 LineStart = 0;
+		for (int32 Index = 0; Index < Buffer.Num(); Index++)
+		{
+			if (Buffer[Index] == '\n')
+			{
+				PrintLine(LineStart, Index);
+				LineStart = Index + 1;
+			}
+		}
+
+		if (bFlushAll && LineStart < Buffer.Num())
+		{
+			PrintLine(LineStart, Buffer.Num());
+			LineStart = Buffer.Num();
+		}
+
+		Buffer.RemoveAt(0, LineStart, false);
+	}
+
+	void PrintLine(int32 Start, int32 End)
+	{
+		// Skip carriage returns, which are a part of the ImGui newline on some platforms.
+		if (End > Start && Buffer[End - 1] == '\r')
+		{
+			End--;
+		}
+
+		const FUTF8ToTCHAR Line(reinterpret_cast<const ANSICHAR*>(Buffer.GetData() + Start), End - Start);
+		UE_LOG(LogImGuiTTY, Log, TEXT("%.*s"), Line.Length(), Line.Get());
+	}
+};
+
+namespace
+{
+	// Relative paths (like the default log file name) are resolved in the ImGui saved directory.
+	FString GetFilePath(const char* Filename)
+	{
+		FString Path = UTF8_TO_TCHAR(Filename);
+		if (FPaths::IsRelative(Path))
+		{
+#if ENGINE_COMPATIBILITY_LEGACY_SAVED_DIR
+			Path = FPaths::Combine(*FPaths::GameSavedDir(), TEXT("ImGui"), *Path);
+#else
+			Path = FPaths::Combine(*FPaths::ProjectSavedDir(), TEXT("ImGui"), *Path);
+#endif
+		}
+		return Path;
+	}
+}
+
+ImFileHandle ImFileOpen(const char* Filename, const char* Mode)
+{
+	const FString Path = GetFilePath(Filename);
+
+	if (Mode[0] == 'r')
+	{
+		// Make sure that we don't read files that are still being written.
+		FImGuiFileWriter::Get().Flush();
+
+		if (FArchive* Reader = IFileManager::Get().CreateFileReader(*Path))
+		{
+			FImGuiFile* File = new FImGuiFile();
+			File->Reader.Reset(Reader);
+			return File;
+		}
+		return nullptr;
+	}
+
+	// Opening failures are returned to ImGui, like with the default file functions.
+	const int32 WriterFileId = FImGuiFileWriter::Get().Open(Path, Mode[0] == 'a');
+	if (WriterFileId == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	FImGuiFile* File = new FImGuiFile();
+	File->WriterFileId = WriterFileId;
+	return File;
+}
+
+ImFileHandle ImFileOpenTTY()
+{
+	FImGuiFile* File = new FImGuiFile();
+	File->bIsTTY = true;
+	return File;
+}
+
+bool ImFileClose(ImFileHandle File)
+{
+	if (File->bIsTTY)
+	{
+		File->PrintLines(true);
+	}
+	else if (File->WriterFileId != INDEX_NONE)
+	{
+		File->FlushBuffer();
+		FImGuiFileWriter::Get().Close(File->WriterFileId);
+	}
+
+	delete File;
+	return true;
+}
+
+ImU64 ImFileGetSize(ImFileHandle File)
+{
+	return File->Reader ? static_cast<ImU64>(File->Reader->TotalSize()) : static_cast<ImU64>(-1);
+}
+
+ImU64 ImFileRead(void* Data, ImU64 Size, ImU64 Count, ImFileHandle File)
+{
+	if (!File->Reader || Size == 0)
+	{
+		return 0;
+	}
+
+	const int64 Remaining = File->Reader->TotalSize() - File->Reader->Tell();
+	const ImU64 ReadCount = FMath::Min<ImU64>(Count, static_cast<ImU64>(Remaining) / Size);
+	File->Reader->Serialize(Data, static_cast<int64>(ReadCount * Size));
+	return File->Reader->IsError() ? 0 : ReadCount;
+}
+
+ImU64 ImFileWrite(const void* Data, ImU64 Size, ImU64 Count, ImFileHandle File)
+{
+	if (File->bIsTTY)
+	{
+		File->Buffer.Append(static_cast<const uint8*>(Data), static_cast<int32>(Size * Count));
+		File->PrintLines(false);
+		return Count;
+	}
+
+	if (File->WriterFileId == INDEX_NONE)
+	{
+		return 0;
+	}
+
+	File->Buffer.Append(static_cast<const uint8*>(Data), static_cast<int32>(Size * Count));
+	if (File->Buffer.Num() >= FileChunkSize)
+	{
+		File->FlushBuffer();
+	}
+	return Count;
+}
@@ -0,0 +1,114 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <Containers/Queue.h>
+#include <HAL/Runnable.h>
+#include <HAL/ThreadSafeCounter64.h>
+
+#include <atomic>
+
+
+class FEvent;
+class FRunnableThread;
+class IFileHandle;
+
+// Writes ImGui files (logs and settings) on a background thread, so callers only need to copy data to memory. Memory
+// used by pending data is bounded. If that limit is reached, writers wait until the background thread catches up.
+// Files are identified by ids returned when they are opened. Operations on one file are executed in order.
+class FImGuiFileWriter : private FRunnable
+{
+public:
+
+	struct FStats
+	{
+		// Bytes written to files since start.
+		int64 BytesWritten = 0;
+
+		// Bytes waiting to be written.
+		int64 PendingBytes = 0;
+
+		// Time between queueing and writing data in the last and the slowest flush.
+		double LastFlushLatency = 0.0;
+		double MaxFlushLatency = 0.0;
+
+		// Time that writers spent waiting for memory to be released.
+		double StallTime = 0.0;
+	};
+
+	// Get the writer instance (created on the first use).
+	static FImGuiFileWriter& Get();
+
+	// Write all pending data and stop the background thread. Writer can be used again after that.
+	static void Shutdown();
+
+	FImGuiFileWriter(const FImGuiFileWriter&) = delete;
+	FImGuiFileWriter& operator=(const FImGuiFileWriter&) = delete;
+
+	FImGuiFileWriter(FImGuiFileWriter&&) = delete;
+	FImGuiFileWriter& operator=(FImGuiFileWriter&&) = delete;
+
+	~FImGuiFileWriter();
+
+	// Open a file for writing. Files are opened on the calling thread, so failures can be reported, after pending
+	// operations are completed (they can target the same file).
+	// @param Path - Absolute path to the file
+	// @param bAppend - Whether to append to an existing file or truncate it
+	// @returns Id to use with other functions or INDEX_NONE, if the file couldn't be opened
+	int32 Open(const FString& Path, bool bAppend);
+
+	// Queue data to write to a file. May block, if there is too much pending data.
+	void Write(int32 FileId, TArray<uint8>&& Data);
+
+	// Queue closing a file.
+	void Close(int32 FileId);
+
+	// Block until all queued operations are completed.
+	void Flush();
+
+	// Get the writer statistics.
+	FStats GetStats() const;
+
+private:
+
+	enum class EOperation : uint8
+	{
+		Write,
+		Close
+	};
+
+	struct FRequest
+	{
+		int32 FileId;
+		EOperation Operation;
+		TArray<uint8> Data;
+		double QueueTime;
+	};
+
+	FImGuiFileWriter();
+
+	void Enqueue(FRequest&& Request);
+	void ProcessRequests();
+	void ProcessRequest(FRequest& Request);
+
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+	TQueue<FRequest, EQueueMode::Mpsc> Requests;
+	TMap<int32, TUniquePtr<IFileHandle>> Files;
+
+	FEvent* WorkEvent = nullptr;
+	FRunnableThread* Thread = nullptr;
+	FCriticalSection ProcessingCriticalSection;
+
+	FThreadSafeCounter64 PendingBytes;
+	FThreadSafeCounter64 PendingRequests;
+	FThreadSafeCounter64 BytesWritten;
+	std::atomic<int32> NextFileId{ 0 };
+	std::atomic<bool> bStopping{ false };
+
+	// Latency and stall times in microseconds.
+	FThreadSafeCounter64 LastFlushLatency;
+	FThreadSafeCounter64 MaxFlushLatency;
+	FThreadSafeCounter64 StallTime;
+};
@@ -0,0 +1,287 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiFlightRecorder.h"
+
+#include "ImGuiFileWriter.h"
+#include "VersionCompatibility.h"
+
+#include <HAL/IConsoleManager.h>
+#include <Misc/Compression.h>
+#include <Misc/Paths.h>
+
+#include <imgui_internal.h>
+
+
+DEFINE_LOG_CATEGORY_STATIC(LogImGuiFlightRecorder, Log, All);
+
+namespace CVars
+{
+	TAutoConsoleVariable<int> FlightRecorderFrames(TEXT("ImGui.FlightRecorder.Frames"), 120,
+		TEXT("Number of frames recorded in each ImGui context. 0 disables recording."),
+		ECVF_Default);
+
+	TAutoConsoleVariable<int> FlightRecorderFramesAfterSpike(TEXT("ImGui.FlightRecorder.FramesAfterSpike"), 30,
+		TEXT("Number of frames recorded after a spike, before frames are dumped."),
+		ECVF_Default);
+
+	TAutoConsoleVariable<float> FlightRecorderSpikeThreshold(TEXT("ImGui.FlightRecorder.SpikeThresholdMs"), 8.f,
+		TEXT("Time in milliseconds that an ImGui context can spend in a frame before it is considered a spike.\n")
+		TEXT("0 disables dumping."),
+		ECVF_Default);
+
+	TAutoConsoleVariable<int> FlightRecorderDrawData(TEXT("ImGui.FlightRecorder.DrawData"), 0,
+		TEXT("Whether the flight recorder should keep compressed draw data of recorded frames.\n")
+		TEXT("0: record only timings and counts (default)\n")
+		TEXT("1: record draw data (adds compression time to every frame)"),
+		ECVF_Default);
+}
+
+namespace
+{
+	FString GetDumpDirectory()
+	{
+#if ENGINE_COMPATIBILITY_LEGACY_SAVED_DIR
+		return FPaths::Combine(*FPaths::GameSavedDir(), TEXT("ImGui"), TEXT("FlightRecorder"));
+#else
+		return FPaths::Combine(*FPaths::ProjectSavedDir(), TEXT("ImGui"), TEXT("FlightRecorder"));
+#endif
+	}
+
+	template<typename T>
+	void Append(TArray<uint8>& Buffer, const T* Data, int32 Num)
+	{
+		Buffer.Append(reinterpret_cast<const uint8*>(Data), Num * sizeof(T));
+	}
+
+	template<typename T>
+	void Append(TArray<uint8>& Buffer, const T& Value)
+	{
+		Append(Buffer, &Value, 1);
+	}
+
+	TArray<uint8> ToUTF8(const FString& String)
+	{
+		FTCHARToUTF8 Converted(*String);
+		TArray<uint8> Data;
+		Append(Data, Converted.Get(), Converted.Length());
+		return Data;
+	}
+
+	double ToMilliseconds(uint32 Cycles)
+	{
+		return FPlatformTime::ToMilliseconds(Cycles);
+	}
+}
+
+uint32 FImGuiFlightRecorder::FFrameRecord::GetTotalCycles() const
+{
+	uint32 Total = 0;
+	for (uint32 Cycles : PhaseCycles)
+	{
+		Total += Cycles;
+	}
+	return Total;
+}
+
+FImGuiFlightRecorder::FImGuiFlightRecorder(const FString& InContextName)
+	: ContextName(InContextName)
+{
+}
+
+void FImGuiFlightRecorder::RecordFrameData(const ImGuiContext& Context, const ImDrawData* DrawData)
+{
+	const uint32 StartCycles = FPlatformTime::Cycles();
+
+	Current.FrameNumber = GFrameNumber;
+	Current.NumWindows = Context.WindowsActiveCount;
+
+	if (DrawData)
+	{
+		Current.NumDrawLists = DrawData->CmdListsCount;
+		Current.NumVertices = DrawData->TotalVtxCount;
+		Current.NumIndices = DrawData->TotalIdxCount;
+		for (int32 Index = 0; Index < DrawData->CmdListsCount; Index++)
+		{
+			Current.NumCommands += DrawData->CmdLists[Index]->CmdBuffer.Size;
+		}
+	}
+
+	Current.RecorderCycles += FPlatformTime::Cycles() - StartCycles;
+
+	if (DrawData && Frames.Num() > 0 && CVars::FlightRecorderDrawData.GetValueOnGameThread() > 0)
+	{
+		RecordDrawData(*DrawData);
+	}
+}
+
+void FImGuiFlightRecorder::EndFrame()
+{
+	const uint32 StartCycles = FPlatformTime::Cycles();
+
+	const int32 Capacity = FMath::Max(CVars::FlightRecorderFrames.GetValueOnGameThread(), 0);
+	if (Frames.Num() != Capacity)
+	{
+		// Restart recording with the new capacity.
+		Frames.Empty(Capacity);
+		Frames.SetNum(Capacity);
+		NextFrame = 0;
+		NumFrames = 0;
+		FramesUntilDump = INDEX_NONE;
+		DumpCooldown = 0;
+	}
+
+	if (Capacity > 0)
+	{
+		Current.RecorderCycles += FPlatformTime::Cycles() - StartCycles;
+		CommitFrame();
+	}
+
+	// Reset the current frame, keeping the draw data buffer for reuse.
+	TArray<uint8> DrawDataStorage = MoveTemp(Current.DrawData);
+	DrawDataStorage.Reset();
+	Current = FFrameRecord{};
+	Current.DrawData = MoveTemp(DrawDataStorage);
+}
+
+void FImGuiFlightRecorder::RecordDrawData(const ImDrawData& DrawData)
+{
+	// Uncompressed format: for each draw list, numbers of commands, vertices and indices followed by commands (clip
+	// rectangle, texture id, index offset, vertex offset and element count), vertices and indices.
+	DrawDataBuffer.Reset();
+	for (int32 ListIndex = 0; ListIndex < DrawData.CmdListsCount; ListIndex++)
+	{
+		const ImDrawList& DrawList = *DrawData.CmdLists[ListIndex];
+
+		Append(DrawDataBuffer, DrawList.CmdBuffer.Size);
+		Append(DrawDataBuffer, DrawList.VtxBuffer.Size);
+		Append(DrawDataBuffer, DrawList.IdxBuffer.Size);
+
+		for (const ImDrawCmd& Command : DrawList.CmdBuffer)
+		{
+			Append(DrawDataBuffer, Command.ClipRect);
+			Append(DrawDataBuffer, (int32)(intptr_t)Command.TextureId);
+			Append(DrawDataBuffer, Command.IdxOffset);
+			Append(DrawDataBuffer, Command.VtxOffset);
+			Append(DrawDataBuffer, Command.ElemCount);
+		}
+
+		Append(DrawDataBuffer, DrawList.VtxBuffer.Data, DrawList.VtxBuffer.Size);
+		Append(DrawDataBuffer, DrawList.IdxBuffer.Data, DrawList.IdxBuffer.Size);
+	}
+
+#if ENGINE_COMPATIBILITY_LEGACY_COMPRESSION_API
+	int32 CompressedSize = FCompression::CompressMemoryBound(COMPRESS_ZLIB, DrawDataBuffer.Num());
+	Current.DrawData.SetNumUninitialized(CompressedSize, false);
+	const bool bCompressed = FCompression::CompressMemory(COMPRESS_ZLIB, Current.DrawData.GetData(), CompressedSize,
+		DrawDataBuffer.GetData(), DrawDataBuffer.Num());
+#else
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, DrawDataBuffer.Num());
+	Current.DrawData.SetNumUninitialized(CompressedSize, false);
+	const bool bCompressed = FCompression::CompressMemory(NAME_Zlib, Current.DrawData.GetData(), CompressedSize,
+		DrawDataBuffer.GetData(), DrawDataBuffer.Num());
+#endif
+
+	Current.DrawData.SetNum(bCompressed ? CompressedSize : 0, false);
+	Current.DrawDataSize = bCompressed ? DrawDataBuffer.Num() : 0;
+}
+
+void FImGuiFlightRecorder::CommitFrame()
+{
+	// Swap, so the buffer of the overwritten frame can be reused.
+	Swap(Frames[NextFrame], Current);
+	const FFrameRecord& Committed = Frames[NextFrame];
+
+	NextFrame = (NextFrame + 1) % Frames.Num();
+	NumFrames = FMath::Min(NumFrames + 1, Frames.Num());
+
+	if (DumpCooldown > 0)
+	{
+		DumpCooldown--;
+	}
+
+	if (FramesUntilDump == INDEX_NONE)
+	{
+		const float SpikeThreshold = CVars::FlightRecorderSpikeThreshold.GetValueOnGameThread();
+		if (SpikeThreshold > 0.f && DumpCooldown == 0 && ToMilliseconds(Committed.GetTotalCycles()) > SpikeThreshold)
+		{
+			SpikeFrameNumber = Committed.FrameNumber;
+			FramesUntilDump = FMath::Clamp(CVars::FlightRecorderFramesAfterSpike.GetValueOnGameThread(), 0, Frames.Num() - 1);
+		}
+	}
+
+	if (FramesUntilDump != INDEX_NONE && FramesUntilDump-- == 0)
+	{
+		Dump();
+		FramesUntilDump = INDEX_NONE;
+
+		// Don't dump again until the dumped frames are out of the buffer, so sustained spikes don't flood the disk.
+		DumpCooldown = Frames.Num();
+	}
+}
+
+void FImGuiFlightRecorder::Dump()
+{
+	const FString BaseName = FPaths::Combine(GetDumpDirectory(),
+		FString::Printf(TEXT("%s-%llu"), *ContextName, (unsigned long long)SpikeFrameNumber));
+
+	FString Text = FString::Printf(TEXT("Context,%s\nSpikeFrame,%llu\nSpikeThresholdMs,%.3f\n\n"), *ContextName,
+		(unsigned long long)SpikeFrameNumber, CVars::FlightRecorderSpikeThreshold.GetValueOnGameThread());
+	Text += TEXT("Frame,NewFrameMs,EarlyDebugMs,DebugMs,ParallelPanelsMs,RenderMs,DrawDataMs,PaintMs,TotalMs,")
+		TEXT("RecorderUs,Windows,DrawLists,Commands,Vertices,Indices,DrawDataBytes\n");
+
+	TArray<uint8> DrawData;
+	const bool bHasDrawData = CVars::FlightRecorderDrawData.GetValueOnGameThread() > 0;
+	if (bHasDrawData)
+	{
+		// Draw data file: magic, version and for each frame: frame number, uncompressed size, compressed size and
+		// zlib compressed data.
+		Append(DrawData, "IMDD", 4);
+		Append(DrawData, (int32)1);
+	}
+
+	const int32 FirstFrame = (NumFrames < Frames.Num()) ? 0 : NextFrame;
+	for (int32 Offset = 0; Offset < NumFrames; Offset++)
+	{
+		const FFrameRecord& Frame = Frames[(FirstFrame + Offset) % Frames.Num()];
+
+		Text += FString::Printf(TEXT("%llu"), (unsigned long long)Frame.FrameNumber);
+		for (uint32 Cycles : Frame.PhaseCycles)
+		{
+			Text += FString::Printf(TEXT(",%.3f"), ToMilliseconds(Cycles));
+		}
+		Text += FString::Printf(TEXT(",%.3f,%.2f,%d,%d,%d,%d,%d,%d\n"), ToMilliseconds(Frame.GetTotalCycles()),
+			ToMilliseconds(Frame.RecorderCycles) * 1000.0, Frame.NumWindows, Frame.NumDrawLists, Frame.NumCommands,
+			Frame.NumVertices, Frame.NumIndices, Frame.DrawData.Num());
+
+		if (bHasDrawData && Frame.DrawData.Num() > 0)
+		{
+			Append(DrawData, Frame.FrameNumber);
+			Append(DrawData, Frame.DrawDataSize);
+			Append(DrawData, Frame.DrawData.Num());
+			DrawData.Append(Frame.DrawData);
+		}
+	}
+
+	FImGuiFileWriter& Writer = FImGuiFileWriter::Get();
+
+	const int32 TextFile = Writer.Open(BaseName + TEXT(".csv"), false);
+	if (TextFile == INDEX_NONE)
+	{
+		UE_LOG(LogImGuiFlightRecorder, Warning, TEXT("ImGui context '%s' spiked in frame %llu, but recorded frames couldn't be dumped to '%s.csv'."),
+			*ContextName, (unsigned long long)SpikeFrameNumber, *BaseName);
+		return;
+	}
+
+	Writer.Write(TextFile, ToUTF8(Text));
+	Writer.Close(TextFile);
+
+	if (bHasDrawData)
+	{
+		const int32 DrawDataFile = Writer.Open(BaseName + TEXT(".imdd"), false);
+		Writer.Write(DrawDataFile, MoveTemp(DrawData));
+		Writer.Close(DrawDataFile);
+	}
+
+	UE_LOG(LogImGuiFlightRecorder, Log, TEXT("ImGui context '%s' spiked in frame %llu. Recorded frames dumped to '%s.csv'."),
+		*ContextName, (unsigned long long)SpikeFrameNumber, *BaseName);
+}
@@ -0,0 +1,131 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <Containers/Array.h>
+#include <Containers/UnrealString.h>
+#include <HAL/PlatformTime.h>
+
+
+struct ImDrawData;
+struct ImGuiContext;
+
+// Timed phases of a context frame.
+enum class EImGuiFramePhase : uint8
+{
+	// Copying input and starting a new frame.
+	NewFrame,
+
+	// Early debug and debug delegates.
+	EarlyDebug,
+	Debug,
+
+	// Launching parallel panels and waiting for them at the end of the frame.
+	ParallelPanels,
+
+	// Rendering and transferring draw data.
+	Render,
+	DrawData,
+
+	// Converting draw data to Slate elements (output of the previous frame, painted while this frame is built).
+	Paint,
+
+	Num
+};
+
+// Continuously records timings and counts of context frames in a bounded ring buffer. When a frame takes longer than
+// a threshold, frames around it are dumped to the ImGui saved directory. Recording can be controlled with console
+// variables under ImGui.FlightRecorder.
+class FImGuiFlightRecorder
+{
+public:
+
+	// Adds time spent in its scope to one of the phases of the current frame.
+	struct FScope
+	{
+		FScope(FImGuiFlightRecorder& InRecorder, EImGuiFramePhase InPhase)
+			: Recorder(InRecorder)
+			, Phase(InPhase)
+			, StartCycles(FPlatformTime::Cycles())
+		{
+		}
+
+		~FScope()
+		{
+			Recorder.Current.PhaseCycles[(uint8)Phase] += FPlatformTime::Cycles() - StartCycles;
+		}
+
+		FScope(const FScope&) = delete;
+		FScope& operator=(const FScope&) = delete;
+
+	private:
+
+		FImGuiFlightRecorder& Recorder;
+		EImGuiFramePhase Phase;
+		uint32 StartCycles;
+	};
+
+	FImGuiFlightRecorder(const FString& InContextName);
+
+	FImGuiFlightRecorder(const FImGuiFlightRecorder&) = delete;
+	FImGuiFlightRecorder& operator=(const FImGuiFlightRecorder&) = delete;
+
+	FImGuiFlightRecorder(FImGuiFlightRecorder&&) = delete;
+	FImGuiFlightRecorder& operator=(FImGuiFlightRecorder&&) = delete;
+
+	// Record counts (and optionally draw data) of the current frame. Should be called after the frame is rendered and
+	// before its draw data are transferred.
+	// @param Context - Context that rendered the frame
+	// @param DrawData - Draw data of the frame (can be null)
+	void RecordFrameData(const ImGuiContext& Context, const ImDrawData* DrawData);
+
+	// Move the current frame to the ring buffer and dump recorded frames, if needed.
+	void EndFrame();
+
+private:
+
+	struct FFrameRecord
+	{
+		uint64 FrameNumber = 0;
+		uint32 PhaseCycles[(uint8)EImGuiFramePhase::Num] = {};
+
+		// Time spent in the recorder (excluding phase scopes, draw data compression and dumps).
+		uint32 RecorderCycles = 0;
+
+		int32 NumWindows = 0;
+		int32 NumDrawLists = 0;
+		int32 NumCommands = 0;
+		int32 NumVertices = 0;
+		int32 NumIndices = 0;
+
+		// Compressed draw data (only if enabled).
+		TArray<uint8> DrawData;
+		int32 DrawDataSize = 0;
+
+		uint32 GetTotalCycles() const;
+	};
+
+	void RecordDrawData(const ImDrawData& DrawData);
+	void CommitFrame();
+
+	void Dump();
+
+	FString ContextName;
+
+	FFrameRecord Current;
+
+	// Ring buffer with frames ordered from the oldest, starting at NextFrame, if the buffer is full.
+	TArray<FFrameRecord> Frames;
+	int32 NextFrame = 0;
+	int32 NumFrames = 0;
+
+	// Frames to record before dumping or INDEX_NONE, if there is no pending dump.
+	int32 FramesUntilDump = INDEX_NONE;
+	uint64 SpikeFrameNumber = 0;
+
+	// Frames to record before another spike can be dumped.
+	int32 DumpCooldown = 0;
+
+	// Buffer for uncompressed draw data.
+	TArray<uint8> DrawDataBuffer;
+};
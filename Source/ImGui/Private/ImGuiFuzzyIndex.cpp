@@ -0,0 +1,244 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiFuzzyIndex.h"
+
+
+namespace
+{
+	// Score components. Matches at word starts and consecutive matches are preferred, while gaps between matched
+	// characters and matches starting late in the name are penalised.
+	constexpr int32 MatchScore = 16;
+	constexpr int32 WordStartBonus = 24;
+	constexpr int32 ConsecutiveBonus = 16;
+	constexpr int32 MaxGapPenalty = 12;
+	constexpr int32 MaxLeadingPenalty = 12;
+
+	constexpr int32 MaxQueryLength = 256;
+
+	FORCEINLINE ANSICHAR ToLower(ANSICHAR Char)
+	{
+		return (Char >= 'A' && Char <= 'Z') ? Char + ('a' - 'A') : Char;
+	}
+
+	// Letters and digits have their own bits and remaining characters share the rest.
+	FORCEINLINE uint64 GetCharMask(ANSICHAR LowerChar)
+	{
+		if (LowerChar >= 'a' && LowerChar <= 'z')
+		{
+			return 1ull << (LowerChar - 'a');
+		}
+		else if (LowerChar >= '0' && LowerChar <= '9')
+		{
+			return 1ull << (26 + LowerChar - '0');
+		}
+		else
+		{
+			return 1ull << (36 + static_cast<uint8>(LowerChar) % 28);
+		}
+	}
+
+	FORCEINLINE bool IsSeparator(ANSICHAR Char)
+	{
+		return Char == '.' || Char == '_' || Char == ' ' || Char == '-' || Char == '/' || Char == ':';
+	}
+
+	FORCEINLINE bool IsWordStart(const ANSICHAR* Name, int32 Position)
+	{
+		if (Position == 0)
+		{
+			return true;
+		}
+
+		const ANSICHAR Char = Name[Position];
+		const ANSICHAR Previous = Name[Position - 1];
+		return IsSeparator(Previous)
+			|| (Char >= 'A' && Char <= 'Z' && !(Previous >= 'A' && Previous <= 'Z'))
+			|| (Char >= '0' && Char <= '9' && !(Previous >= '0' && Previous <= '9'));
+	}
+
+	struct FRankedEntry
+	{
+		int32 Entry;
+		int32 Score;
+		int32 Length;
+	};
+
+	// Better entries have higher scores, then shorter names and then were added earlier.
+	FORCEINLINE bool IsBetter(const FRankedEntry& A, const FRankedEntry& B)
+	{
+		if (A.Score != B.Score)
+		{
+			return A.Score > B.Score;
+		}
+		else if (A.Length != B.Length)
+		{
+			return A.Length < B.Length;
+		}
+		else
+		{
+			return A.Entry < B.Entry;
+		}
+	}
+}
+
+int32 FImGuiFuzzyIndex::Add(const ANSICHAR* Name, int32 Length)
+{
+	if (Length == INDEX_NONE)
+	{
+		Length = FCStringAnsi::Strlen(Name);
+	}
+
+	uint64 Mask = 0;
+	for (const ANSICHAR* Char = Name; Char < Name + Length; Char++)
+	{
+		const ANSICHAR LowerChar = ToLower(*Char);
+		Names.Add(*Char);
+		LowerNames.Add(LowerChar);
+		Mask |= GetCharMask(LowerChar);
+	}
+	Names.Add('\0');
+	LowerNames.Add('\0');
+
+	Offsets.Add(Names.Num());
+	return Masks.Add(Mask);
+}
+
+void FImGuiFuzzyIndex::Reset()
+{
+	Names.Reset();
+	LowerNames.Reset();
+	Offsets.Reset();
+	Offsets.Add(0);
+	Masks.Reset();
+}
+
+int32 FImGuiFuzzyIndex::Score(int32 Entry, const ANSICHAR* Query, int32 QueryLength) const
+{
+	const ANSICHAR* Name = &Names[Offsets[Entry]];
+	const ANSICHAR* LowerName = &LowerNames[Offsets[Entry]];
+	const int32 Length = GetLength(Entry);
+
+	int32 Total = 0;
+	int32 Position = 0;
+	int32 Previous = INDEX_NONE;
+
+	for (int32 QueryIndex = 0; QueryIndex < QueryLength; QueryIndex++)
+	{
+		// Greedily match the next occurrence of the query character.
+		while (Position < Length && LowerName[Position] != Query[QueryIndex])
+		{
+			Position++;
+		}
+
+		if (Position == Length)
+		{
+			return INDEX_NONE;
+		}
+
+		Total += MatchScore;
+		if (IsWordStart(Name, Position))
+		{
+			Total += WordStartBonus;
+		}
+
+		if (Previous == INDEX_NONE)
+		{
+			Total -= FMath::Min(Position, MaxLeadingPenalty);
+		}
+		else if (Position == Previous + 1)
+		{
+			Total += ConsecutiveBonus;
+		}
+		else
+		{
+			Total -= FMath::Min(Position - Previous - 1, MaxGapPenalty);
+		}
+
+		Previous = Position++;
+	}
+
+	return Total;
+}
+
+void FImGuiFuzzyIndex::Search(const ANSICHAR* Query, const TArray<int32>* Candidates, TArray<int32>& OutMatches,
+	int32 MaxResults, TArray<int32>& OutResults) const
+{
+	checkf(Candidates != &OutMatches, TEXT("Candidates and matches need to be different arrays."));
+
+	// Lower-case query without spaces and its character mask.
+	ANSICHAR LowerQuery[MaxQueryLength];
+	int32 QueryLength = 0;
+	uint64 QueryMask = 0;
+	for (const ANSICHAR* Char = Query; *Char && QueryLength < MaxQueryLength; Char++)
+	{
+		if (*Char != ' ')
+		{
+			LowerQuery[QueryLength] = ToLower(*Char);
+			QueryMask |= GetCharMask(LowerQuery[QueryLength]);
+			QueryLength++;
+		}
+	}
+
+	// Prefilter entries by their character masks. Every entry is written and the output position only advances if it
+	// passes, so the loop has no branches.
+	const uint64* MaskData = Masks.GetData();
+	int32 NumMatches = 0;
+	if (Candidates)
+	{
+		OutMatches.SetNumUninitialized(Candidates->Num(), false);
+		int32* MatchData = OutMatches.GetData();
+		for (const int32 Entry : *Candidates)
+		{
+			MatchData[NumMatches] = Entry;
+			NumMatches += static_cast<int32>((MaskData[Entry] & QueryMask) == QueryMask);
+		}
+	}
+	else
+	{
+		OutMatches.SetNumUninitialized(Masks.Num(), false);
+		int32* MatchData = OutMatches.GetData();
+		for (int32 Entry = 0; Entry < Masks.Num(); Entry++)
+		{
+			MatchData[NumMatches] = Entry;
+			NumMatches += static_cast<int32>((MaskData[Entry] & QueryMask) == QueryMask);
+		}
+	}
+
+	// Score the remaining entries and keep the best ones in a heap with the worst result on top.
+	const auto IsWorse = [](const FRankedEntry& A, const FRankedEntry& B) { return IsBetter(B, A); };
+	TArray<FRankedEntry> Ranked;
+	Ranked.Reserve(FMath::Min(MaxResults, NumMatches));
+
+	int32 NumScored = 0;
+	for (int32 Index = 0; Index < NumMatches; Index++)
+	{
+		const int32 Entry = OutMatches[Index];
+		const int32 EntryScore = Score(Entry, LowerQuery, QueryLength);
+		if (EntryScore == INDEX_NONE)
+		{
+			continue;
+		}
+
+		OutMatches[NumScored++] = Entry;
+
+		const FRankedEntry Candidate{ Entry, EntryScore, GetLength(Entry) };
+		if (Ranked.Num() < MaxResults)
+		{
+			Ranked.HeapPush(Candidate, IsWorse);
+		}
+		else if (MaxResults > 0 && IsBetter(Candidate, Ranked.HeapTop()))
+		{
+			Ranked.HeapPopDiscard(IsWorse, false);
+			Ranked.HeapPush(Candidate, IsWorse);
+		}
+	}
+	OutMatches.SetNum(NumScored, false);
+
+	Ranked.Sort([](const FRankedEntry& A, const FRankedEntry& B) { return IsBetter(A, B); });
+
+	OutResults.Reset(Ranked.Num());
+	for (const FRankedEntry& Entry : Ranked)
+	{
+		OutResults.Add(Entry.Entry);
+	}
+}
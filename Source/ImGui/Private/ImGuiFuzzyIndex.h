@@ -0,0 +1,56 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+
+// Index of names for fuzzy subsequence matching, in which query characters need to appear in names in the same order
+// but not necessarily next to each other. Names are stored in contiguous buffers together with 64-bit masks of the
+// characters that they contain. Searches first reject names that are missing any query character by testing their
+// masks in one branch-free pass, and then only score the remaining names. Entries can be added at any time without
+// rebuilding the index.
+class FImGuiFuzzyIndex
+{
+public:
+
+	// Add a name to the index.
+	// @param Name - UTF-8 name (matching is case-insensitive for ASCII characters)
+	// @param Length - Length of the name or INDEX_NONE if it is null-terminated
+	// @returns Index of the new entry
+	int32 Add(const ANSICHAR* Name, int32 Length = INDEX_NONE);
+
+	// Remove all entries.
+	void Reset();
+
+	// Get the number of entries.
+	int32 Num() const { return Masks.Num(); }
+
+	// Get the name of an entry.
+	const ANSICHAR* GetName(int32 Entry) const { return &Names[Offsets[Entry]]; }
+
+	// Find entries that match a query and rank the best of them.
+	// @param Query - UTF-8 query (spaces are ignored)
+	// @param Candidates - Entries to search or null to search all entries. Matches of a query are valid candidates for
+	//     any query that extends it.
+	// @param OutMatches - All entries that match the query (can't be the same array as candidates)
+	// @param MaxResults - Maximal number of ranked results
+	// @param OutResults - Best matches sorted from the best
+	void Search(const ANSICHAR* Query, const TArray<int32>* Candidates, TArray<int32>& OutMatches, int32 MaxResults,
+		TArray<int32>& OutResults) const;
+
+private:
+
+	// Get the score of a name or INDEX_NONE if it doesn't match.
+	int32 Score(int32 Entry, const ANSICHAR* Query, int32 QueryLength) const;
+
+	int32 GetLength(int32 Entry) const { return Offsets[Entry + 1] - Offsets[Entry] - 1; }
+
+	// Null-terminated names in original and lower case and their offsets, with an extra offset at the end.
+	TArray<ANSICHAR> Names;
+	TArray<ANSICHAR> LowerNames;
+	TArray<int32> Offsets = { 0 };
+
+	// Masks of characters in names.
+	TArray<uint64> Masks;
+};
@@ -0,0 +1,170 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiGeometryQuality.h"
+
+#include <HAL/IConsoleManager.h>
+
+#include <imgui.h>
+
+
+namespace CVars
+{
+	TAutoConsoleVariable<int> QualityAdaptive(TEXT("ImGui.Quality.Adaptive"), 1,
+		TEXT("Whether geometry quality of ImGui contexts should adapt to display density and vertex budget.\n")
+		TEXT("0: disabled, style values are used as they are\n")
+		TEXT("1: enabled (default)"),
+		ECVF_Default);
+
+	TAutoConsoleVariable<float> QualityMinFringePoints(TEXT("ImGui.Quality.MinFringePoints"), 0.6f,
+		TEXT("Minimal width of anti-aliased fringes in points (screen pixels divided by DPI scale). Narrower fringes are\n")
+		TEXT("dropped. 0 keeps fringes at any density."),
+		ECVF_Default);
+
+	TAutoConsoleVariable<int> QualityVertexBudget(TEXT("ImGui.Quality.VertexBudget"), 0,
+		TEXT("Number of vertices that each ImGui context can draw in a frame before its geometry quality is lowered.\n")
+		TEXT("0 disables the budget."),
+		ECVF_Default);
+}
+
+namespace
+{
+	// Fraction of the budget below which quality can be raised again.
+	constexpr float BudgetRecoveryFraction = 0.8f;
+
+	// Number of frames that need to fit in the recovery fraction before quality is raised (this is to avoid
+	// oscillation between levels).
+	constexpr int32 BudgetRecoveryFrames = 30;
+
+	// Weight of a new frame in running averages of vertex counts.
+	constexpr float AverageWeight = 0.05f;
+
+	// Round density to steps of square root of two, so small changes (e.g. during canvas zoom) don't update
+	// tessellation in every frame.
+	float QuantizeDensity(float Density)
+	{
+		return FMath::Pow(2.f, FMath::RoundToFloat(FMath::Log2(Density) * 2.f) * 0.5f);
+	}
+
+	void UpdateAverage(float& Average, int32 Value)
+	{
+		Average = (Average < 0.f) ? Value : FMath::Lerp(Average, (float)Value, AverageWeight);
+	}
+}
+
+void FImGuiGeometryQuality::AddViewDensity(float PointsPerUnit)
+{
+	PendingDensity = FMath::Max(PendingDensity, PointsPerUnit);
+}
+
+void FImGuiGeometryQuality::BeginFrame(ImGuiStyle& Style)
+{
+	if (PendingDensity > 0.f)
+	{
+		Density = PendingDensity;
+		PendingDensity = 0.f;
+	}
+
+	// Style can be changed by the user at any time, so base values are read from it in every frame.
+	BaseCircleTessellationMaxError = Style.CircleTessellationMaxError;
+	BaseCurveTessellationTol = Style.CurveTessellationTol;
+	bBaseAntiAliasedLines = Style.AntiAliasedLines;
+	bBaseAntiAliasedFill = Style.AntiAliasedFill;
+
+	if (CVars::QualityAdaptive.GetValueOnGameThread() <= 0)
+	{
+		ResetQuality();
+		BudgetLevel = 0;
+		FramesUnderBudget = 0;
+		return;
+	}
+
+	// Tolerances are in ImGui units, so to keep the error constant in points, they need to be divided by density.
+	float ErrorScale = 1.f / QuantizeDensity(FMath::Max(Density, KINDA_SMALL_NUMBER));
+	if (BudgetLevel >= 1)
+	{
+		ErrorScale *= (BudgetLevel >= 3) ? 4.f : 2.f;
+	}
+	ErrorScale = FMath::Clamp(ErrorScale, 0.25f, 16.f);
+
+	// Fringes are one unit wide.
+	const float MinFringePoints = CVars::QualityMinFringePoints.GetValueOnGameThread();
+	const bool bSubPointFringes = Density < MinFringePoints;
+
+	bFillFringesDropped = bBaseAntiAliasedFill && (bSubPointFringes || BudgetLevel >= 2);
+	bLineFringesDropped = bBaseAntiAliasedLines && (bSubPointFringes || BudgetLevel >= 3);
+
+	Style.CircleTessellationMaxError = BaseCircleTessellationMaxError * ErrorScale;
+	Style.CurveTessellationTol = BaseCurveTessellationTol * ErrorScale;
+	Style.AntiAliasedFill = bBaseAntiAliasedFill && !bFillFringesDropped;
+	Style.AntiAliasedLines = bBaseAntiAliasedLines && !bLineFringesDropped;
+
+	TessellationError = Style.CircleTessellationMaxError * Density;
+	bReduced = (ErrorScale > 1.f) || bFillFringesDropped || bLineFringesDropped;
+	bAdapted = true;
+	bApplied = true;
+}
+
+void FImGuiGeometryQuality::RestoreStyle(ImGuiStyle& Style)
+{
+	if (bApplied)
+	{
+		Style.CircleTessellationMaxError = BaseCircleTessellationMaxError;
+		Style.CurveTessellationTol = BaseCurveTessellationTol;
+		Style.AntiAliasedLines = bBaseAntiAliasedLines;
+		Style.AntiAliasedFill = bBaseAntiAliasedFill;
+		bApplied = false;
+	}
+}
+
+void FImGuiGeometryQuality::EndFrame(int32 NumVertices)
+{
+	if (!bAdapted)
+	{
+		return;
+	}
+
+	UpdateAverage(bReduced ? ReducedAverageVertices : FullAverageVertices, NumVertices);
+
+	const int32 Budget = CVars::QualityVertexBudget.GetValueOnGameThread();
+	if (Budget <= 0)
+	{
+		BudgetLevel = 0;
+		FramesUnderBudget = 0;
+	}
+	else if (NumVertices > Budget)
+	{
+		BudgetLevel = FMath::Min(BudgetLevel + 1, MaxBudgetLevel);
+		FramesUnderBudget = 0;
+	}
+	else if (BudgetLevel > 0 && NumVertices < Budget * BudgetRecoveryFraction)
+	{
+		if (++FramesUnderBudget >= BudgetRecoveryFrames)
+		{
+			BudgetLevel--;
+			FramesUnderBudget = 0;
+		}
+	}
+	else
+	{
+		FramesUnderBudget = 0;
+	}
+}
+
+float FImGuiGeometryQuality::GetEstimatedVertexReduction() const
+{
+	if (ReducedAverageVertices < 0.f || FullAverageVertices <= 0.f)
+	{
+		return -1.f;
+	}
+
+	return FMath::Max(1.f - ReducedAverageVertices / FullAverageVertices, 0.f);
+}
+
+void FImGuiGeometryQuality::ResetQuality()
+{
+	TessellationError = BaseCircleTessellationMaxError * Density;
+	bLineFringesDropped = false;
+	bFillFringesDropped = false;
+	bReduced = false;
+	bAdapted = false;
+}
@@ -0,0 +1,86 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+
+struct ImGuiStyle;
+
+// Adapts geometry quality of a context to the density at which it is displayed and to an optional vertex budget (see
+// ImGui.Quality console variables).
+//
+// Density is measured in points per ImGui unit, where a point is a screen pixel divided by the DPI scale. Tessellation
+// tolerances are scaled to keep the same error in points, so contexts drawn on high DPI screens or zoomed out in the
+// canvas use fewer segments. Anti-aliased fringes, which are one ImGui unit wide, are dropped when they would be
+// narrower than a threshold. When the context exceeds its vertex budget, quality is lowered in steps until it fits.
+class FImGuiGeometryQuality
+{
+public:
+
+	// Number of quality steps that can be taken to fit in the vertex budget.
+	static constexpr int32 MaxBudgetLevel = 3;
+
+	// Add density of one of the views that display the context. The highest density reported before the next frame
+	// is used. If nothing is reported, the last known density is kept.
+	// @param PointsPerUnit - Number of points per ImGui unit in the view
+	void AddViewDensity(float PointsPerUnit);
+
+	// Update quality and apply it to the style. Should be called before a new frame starts. Current style values are
+	// used at full quality and density of one point per unit, so changes made by the user are picked in every frame.
+	void BeginFrame(ImGuiStyle& Style);
+
+	// Restore style values changed in BeginFrame. Should be called after a new frame starts, which copies them to the
+	// draw list data, so during the frame the style holds values set by the user.
+	void RestoreStyle(ImGuiStyle& Style);
+
+	// Update the vertex budget and statistics with the number of vertices drawn in the frame.
+	void EndFrame(int32 NumVertices);
+
+	// Get the density used in the current frame.
+	float GetDensity() const { return Density; }
+
+	// Get the number of quality steps taken to fit in the vertex budget.
+	int32 GetBudgetLevel() const { return BudgetLevel; }
+
+	// Get the circle tessellation error in points, in the current frame and at full quality.
+	float GetTessellationError() const { return TessellationError; }
+	float GetBaseTessellationError() const { return BaseCircleTessellationMaxError; }
+
+	// Whether anti-aliased fringes of lines and fills are dropped in the current frame.
+	bool AreLineFringesDropped() const { return bLineFringesDropped; }
+	bool AreFillFringesDropped() const { return bFillFringesDropped; }
+
+	// Get the estimated fraction of vertices saved by reduced quality, or a negative value if there are not enough
+	// samples. Estimation compares running averages of frames with and without reduced quality, so it is only
+	// meaningful for a similar content.
+	float GetEstimatedVertexReduction() const;
+
+private:
+
+	void ResetQuality();
+
+	float BaseCircleTessellationMaxError = 0.30f;
+	float BaseCurveTessellationTol = 1.25f;
+	bool bBaseAntiAliasedLines = true;
+	bool bBaseAntiAliasedFill = true;
+
+	float PendingDensity = 0.f;
+	float Density = 1.f;
+
+	int32 BudgetLevel = 0;
+	int32 FramesUnderBudget = 0;
+
+	float TessellationError = 0.f;
+	bool bLineFringesDropped = false;
+	bool bFillFringesDropped = false;
+
+	// Whether quality is reduced in the current frame, whether it is adapted at all and whether adapted values are
+	// currently in the style.
+	bool bReduced = false;
+	bool bAdapted = false;
+	bool bApplied = false;
+
+	float ReducedAverageVertices = -1.f;
+	float FullAverageVertices = -1.f;
+};
@@ -4,6 +4,8 @@
 
 #include <CoreMinimal.h>
 
+#include <atomic>
+
 // For convenience and easy access to the ImGui source code, we build it as part of this module.
 // We don't need to define IMGUI_API manually because it is already done for this module.
 
@@ -41,10 +43,33 @@ struct FImGuiContextHandle : public Utilities::TRedirectingHandle<ImGuiContext*>
 static ImGuiContext* ImGuiContextPtr = nullptr;
 static FImGuiContextHandle ImGuiContextPtrHandle(ImGuiContextPtr);
 
-// Get the global ImGui context pointer (GImGui) indirectly to allow redirections in obsolete modules.
-#define GImGui (ImGuiContextPtrHandle.Get())
+// Get the global ImGui context pointer indirectly to allow redirections in obsolete modules.
+#define IMGUI_SHARED_CONTEXT (ImGuiContextPtrHandle.Get())
+#else
+// Keep the exported global context pointer for code that uses it directly through imgui_internal.h.
+struct ImGuiContext;
+IMGUI_API ImGuiContext* GImGui = nullptr;
+
+#define IMGUI_SHARED_CONTEXT (::GImGui)
 #endif // WITH_EDITOR
 
+// Worker threads building parallel panels use their own contexts, without affecting the shared one.
+static thread_local ImGuiContext* ThreadContextPtr = nullptr;
+static thread_local bool bUseThreadContext = false;
+
+// Number of threads using their own contexts. Thread-local storage is only checked while it is positive, so outside of
+// parallel panels and font builds, context access only costs one relaxed load of this counter. Threads with their own
+// contexts change it themselves, so they always see it as positive.
+static std::atomic<int32> NumThreadContexts{ 0 };
+
+static FORCEINLINE ImGuiContext*& GetCurrentContextRef()
+{
+	return UNLIKELY(NumThreadContexts.load(std::memory_order_relaxed) > 0 && bUseThreadContext) ? ThreadContextPtr : IMGUI_SHARED_CONTEXT;
+}
+
+// Get the ImGui context pointer (GImGui) from the calling thread's override or from the shared pointer.
+#define GImGui (GetCurrentContextRef())
+
 #include "imgui.cpp"
 #include "imgui_demo.cpp"
 #include "imgui_draw.cpp"
@@ -56,11 +81,74 @@ static FImGuiContextHandle ImGuiContextPtrHandle(ImGuiContextPtr);
 #include <Windows/HideWindowsPlatformTypes.h>
 #endif // PLATFORM_WINDOWS
 
+#include "ImGuiAllocationTracker.h"
 #include "ImGuiInteroperability.h"
 
+#include <HAL/ThreadSafeCounter64.h>
+
+
+namespace
+{
+	// Size of the header used to store allocation sizes (keeps the default alignment of returned blocks).
+	constexpr SIZE_T AllocationHeaderSize = 16;
+
+	FThreadSafeCounter64 AllocatedBytes;
+
+	void SetUseThreadContext(bool bUse)
+	{
+		if (bUseThreadContext != bUse)
+		{
+			bUseThreadContext = bUse;
+			NumThreadContexts.fetch_add(bUse ? 1 : -1, std::memory_order_relaxed);
+		}
+	}
+
+	void* TrackingMalloc(size_t Size, void* UserData)
+	{
+		uint8* Block = static_cast<uint8*>(FMemory::Malloc(Size + AllocationHeaderSize));
+		*reinterpret_cast<SIZE_T*>(Block) = Size;
+		AllocatedBytes.Add(Size);
+#if IMGUI_ALLOCATION_TRACKING
+		ImGuiAllocationTracker::RecordImGuiAllocation(Size);
+#endif
+		return Block + AllocationHeaderSize;
+	}
+
+	void TrackingFree(void* Ptr, void* UserData)
+	{
+		if (Ptr)
+		{
+			uint8* Block = static_cast<uint8*>(Ptr) - AllocationHeaderSize;
+			AllocatedBytes.Subtract(*reinterpret_cast<SIZE_T*>(Block));
+			FMemory::Free(Block);
+		}
+	}
+}
 
 namespace ImGuiImplementation
 {
+	void InitializeAllocator()
+	{
+		ImGui::SetAllocatorFunctions(&TrackingMalloc, &TrackingFree);
+	}
+
+	int64 GetAllocatedBytes()
+	{
+		return AllocatedBytes.GetValue();
+	}
+
+	void SetThreadContext(ImGuiContext* Context)
+	{
+		SetUseThreadContext(Context != nullptr);
+		ThreadContextPtr = Context;
+	}
+
+	void DetachThreadContext()
+	{
+		SetUseThreadContext(true);
+		ThreadContextPtr = nullptr;
+	}
+
 #if WITH_EDITOR
 	FImGuiContextHandle& GetContextHandle()
 	{
@@ -2,11 +2,30 @@
 
 #pragma once
 
+#include <HAL/Platform.h>
+
+
 struct FImGuiContextHandle;
+struct ImGuiContext;
 
 // Gives access to selected ImGui implementation features.
 namespace ImGuiImplementation
 {
+	// Set allocator functions that track memory used by ImGui. Must be called before any ImGui allocation is made.
+	void InitializeAllocator();
+
+	// Get the number of bytes currently allocated by ImGui in this module (including all contexts and font atlases).
+	int64 GetAllocatedBytes();
+
+	// Set the ImGui context used by the calling thread instead of the shared current context. While it is set, ImGui
+	// functions called from this thread, including SetCurrentContext, only see and change this thread's context.
+	// @param Context - Context to use in this thread or null to go back to the shared current context
+	void SetThreadContext(ImGuiContext* Context);
+
+	// Detach the calling thread from the shared current context, so it can use parts of ImGui that don't need a context
+	// (like building font atlases) without touching contexts used by other threads. Undone by SetThreadContext.
+	void DetachThreadContext();
+
 #if WITH_EDITOR
 	// Get the handle to the ImGui Context pointer.
 	FImGuiContextHandle& GetContextHandle();
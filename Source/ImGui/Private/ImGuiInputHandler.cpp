@@ -2,6 +2,7 @@
 
 #include "ImGuiInputHandler.h"
 
+#include "ImGuiAllocationTracker.h"
 #include "ImGuiContextProxy.h"
 #include "ImGuiInputState.h"
 #include "ImGuiModuleDebug.h"
@@ -9,6 +10,7 @@
 #include "ImGuiModuleSettings.h"
 #include "VersionCompatibility.h"
 
+#include <Engine/GameViewportClient.h>
 #include <Framework/Application/SlateApplication.h>
 #include <GameFramework/InputSettings.h>
 #include <InputCoreTypes.h>
@@ -29,6 +31,51 @@ namespace
 	{
 		return bConsume ? FReply::Handled() : FReply::Unhandled();
 	}
+
+	// Rules compiled into the key routing table.
+	enum EKeyRoute : uint32
+	{
+		KeyRoute_Console = 1 << 0,
+		KeyRoute_StopPlaySession = 1 << 1,
+		KeyRoute_ToggleInput = 1 << 2,
+	};
+
+	// Each combination of modifier keys has its own group of route bits.
+	constexpr uint32 KeyRouteBits = 4;
+	constexpr uint32 KeyRouteMask = (1u << KeyRouteBits) - 1;
+
+	enum EModifierKey : uint32
+	{
+		Modifier_Shift = 1 << 0,
+		Modifier_Ctrl = 1 << 1,
+		Modifier_Alt = 1 << 2,
+		Modifier_Cmd = 1 << 3,
+
+		Modifier_Combinations = 1 << 4
+	};
+
+	static_assert(Modifier_Combinations * KeyRouteBits <= 64, "Key routes don't fit in 64 bits.");
+
+	uint32 GetModifierMask(bool bShift, bool bCtrl, bool bAlt, bool bCmd)
+	{
+		return (bShift ? Modifier_Shift : 0) | (bCtrl ? Modifier_Ctrl : 0) | (bAlt ? Modifier_Alt : 0) | (bCmd ? Modifier_Cmd : 0);
+	}
+
+	void AddKeyRoute(TMap<FKey, uint64>& KeyRoutes, const FKey& Key, uint32 ModifierMask, EKeyRoute Route)
+	{
+		if (Key.IsValid())
+		{
+			KeyRoutes.FindOrAdd(Key) |= static_cast<uint64>(Route) << (ModifierMask * KeyRouteBits);
+		}
+	}
+
+#if WITH_EDITOR
+	bool CanStopPlaySession(const TSharedPtr<FUICommandInfo>& CommandInfo)
+	{
+		return CommandInfo.IsValid() && FPlayWorldCommands::GlobalPlayWorldActions.IsValid()
+			&& FPlayWorldCommands::GlobalPlayWorldActions->CanExecuteAction(CommandInfo.ToSharedRef());
+	}
+#endif // WITH_EDITOR
 }
 
 FReply UImGuiInputHandler::OnKeyChar(const struct FCharacterEvent& CharacterEvent)
@@ -52,8 +99,11 @@ FReply UImGuiInputHandler::OnKeyDown(const FKeyEvent& KeyEvent)
 	}
 	else
 	{
+		// All rules for this key and modifiers are resolved with a single lookup.
+		const uint32 Routes = GetKeyRoutes(KeyEvent);
+
 		// Ignore console events, so we don't block it from opening.
-		if (IsConsoleEvent(KeyEvent))
+		if (Routes & KeyRoute_Console)
 		{
 			return ToReply(false);
 		}
@@ -61,7 +111,8 @@ FReply UImGuiInputHandler::OnKeyDown(const FKeyEvent& KeyEvent)
 #if WITH_EDITOR
 		// If there is no active ImGui control that would get precedence and this key event is bound to a stop play session
 		// command, then ignore that event and let the command execute.
-		if (!HasImGuiActiveItem() && IsStopPlaySessionEvent(KeyEvent))
+		const bool bStopPlaySessionEvent = (Routes & KeyRoute_StopPlaySession) && CanStopPlaySession(StopPlaySessionCommandInfo);
+		if (bStopPlaySessionEvent && !HasImGuiActiveItem())
 		{
 			return ToReply(false);
 		}
@@ -70,7 +121,7 @@ FReply UImGuiInputHandler::OnKeyDown(const FKeyEvent& KeyEvent)
 		const bool bConsume = !ModuleManager->GetProperties().IsKeyboardInputShared();
 
 		// With shared input we can leave command bindings for DebugExec to handle, otherwise we need to do it here.
-		if (bConsume && IsToggleInputEvent(KeyEvent))
+		if (bConsume && (Routes & KeyRoute_ToggleInput))
 		{
 			ModuleManager->GetProperties().ToggleInput();
 		}
@@ -79,13 +130,16 @@ FReply UImGuiInputHandler::OnKeyDown(const FKeyEvent& KeyEvent)
 		CopyModifierKeys(KeyEvent);
 
 #if WITH_EDITOR
-		if(!bConsume && IsStopPlaySessionEvent(KeyEvent))
+		if(!bConsume && bStopPlaySessionEvent)
 		{
 			// Don't add the `Escape` key event if we didn't consume it
 			// Otherwise it still seems to be pressed when we play again...
 		} else
 #endif // WITH_EDITOR
-		InputState->KeyDownEvents.Add(KeyEvent.GetKeyCode(), KeyEvent);
+		{
+			IMGUI_TRACK_CONTAINER_GROWTH(InputState->KeyDownEvents);
+			InputState->KeyDownEvents.Add(KeyEvent.GetKeyCode(), KeyEvent);
+		}
 
 		return ToReply(bConsume);
 	}
@@ -93,7 +147,10 @@ FReply UImGuiInputHandler::OnKeyDown(const FKeyEvent& KeyEvent)
 
 FReply UImGuiInputHandler::OnKeyUp(const FKeyEvent& KeyEvent)
 {
-	InputState->KeyUpEvents.Add(KeyEvent.GetKeyCode(), KeyEvent);
+	{
+		IMGUI_TRACK_CONTAINER_GROWTH(InputState->KeyUpEvents);
+		InputState->KeyUpEvents.Add(KeyEvent.GetKeyCode(), KeyEvent);
+	}
 	
 	if (KeyEvent.GetKey().IsGamepadKey())
 	{
@@ -263,28 +320,48 @@ void UImGuiInputHandler::CopyModifierKeys(const FInputEvent& InputEvent)
 
 bool UImGuiInputHandler::IsConsoleEvent(const FKeyEvent& KeyEvent) const
 {
-	// Checking modifiers is based on console implementation.
-	const bool bModifierDown = KeyEvent.IsControlDown() || KeyEvent.IsShiftDown() || KeyEvent.IsAltDown() || KeyEvent.IsCommandDown();
-	return !bModifierDown && GetDefault<UInputSettings>()->ConsoleKeys.Contains(KeyEvent.GetKey());
+	return (GetKeyRoutes(KeyEvent) & KeyRoute_Console) != 0;
 }
 
 #if WITH_EDITOR
 bool UImGuiInputHandler::IsStopPlaySessionEvent(const FKeyEvent& KeyEvent) const
 {
-	if (StopPlaySessionCommandInfo.IsValid())
+	return (GetKeyRoutes(KeyEvent) & KeyRoute_StopPlaySession) && CanStopPlaySession(StopPlaySessionCommandInfo);
+}
+#endif // WITH_EDITOR
+
+bool UImGuiInputHandler::IsToggleInputEvent(const FKeyEvent& KeyEvent) const
+{
+	return (GetKeyRoutes(KeyEvent) & KeyRoute_ToggleInput) != 0;
+}
+
+bool UImGuiInputHandler::HasImGuiActiveItem() const
+{
+	FImGuiContextProxy* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextIndex);
+	return ContextProxy && ContextProxy->HasActiveItem();
+}
+
+void UImGuiInputHandler::UpdateInputStatePointer()
+{
+	InputState->SetMousePointer(bMouseInputEnabled && ModuleManager->GetSettings().UseSoftwareCursor());
+}
+
+void UImGuiInputHandler::OnSoftwareCursorChanged(bool)
+{
+	UpdateInputStatePointer();
+}
+
+uint32 UImGuiInputHandler::GetKeyRoutes(const FKeyEvent& KeyEvent) const
+{
+	const uint64* Routes = KeyRoutes.Find(KeyEvent.GetKey());
+	if (!Routes)
 	{
-		const FInputChord InputChord(KeyEvent.GetKey(), KeyEvent.IsShiftDown(), KeyEvent.IsControlDown(), KeyEvent.IsAltDown(), KeyEvent.IsCommandDown());
-#if ENGINE_COMPATIBILITY_SINGLE_KEY_BINDING
-		const bool bHasActiveChord = (InputChord == StopPlaySessionCommandInfo->GetActiveChord().Get());
-#else
-		const bool bHasActiveChord = StopPlaySessionCommandInfo->HasActiveChord(InputChord);
-#endif
-		return bHasActiveChord && FPlayWorldCommands::GlobalPlayWorldActions->CanExecuteAction(StopPlaySessionCommandInfo.ToSharedRef());
+		return 0;
 	}
 
-	return false;
+	const uint32 ModifierMask = GetModifierMask(KeyEvent.IsShiftDown(), KeyEvent.IsControlDown(), KeyEvent.IsAltDown(), KeyEvent.IsCommandDown());
+	return static_cast<uint32>(*Routes >> (ModifierMask * KeyRouteBits)) & KeyRouteMask;
 }
-#endif // WITH_EDITOR
 
 namespace
 {
@@ -293,36 +370,79 @@ namespace
 		return (CheckBoxState == ECheckBoxState::Undetermined) || ((CheckBoxState == ECheckBoxState::Checked) == bValue);
 	}
 
-	bool IsMatchingEvent(const FKeyEvent& KeyEvent, const FImGuiKeyInfo& KeyInfo)
+	bool IsMatchingModifiers(const FImGuiKeyInfo& KeyInfo, uint32 ModifierMask)
 	{
-		return (KeyInfo.Key == KeyEvent.GetKey())
-			&& IsMatching(KeyInfo.Shift, KeyEvent.IsShiftDown())
-			&& IsMatching(KeyInfo.Ctrl, KeyEvent.IsControlDown())
-			&& IsMatching(KeyInfo.Alt, KeyEvent.IsAltDown())
-			&& IsMatching(KeyInfo.Cmd, KeyEvent.IsCommandDown());
+		return IsMatching(KeyInfo.Shift, (ModifierMask & Modifier_Shift) != 0)
+			&& IsMatching(KeyInfo.Ctrl, (ModifierMask & Modifier_Ctrl) != 0)
+			&& IsMatching(KeyInfo.Alt, (ModifierMask & Modifier_Alt) != 0)
+			&& IsMatching(KeyInfo.Cmd, (ModifierMask & Modifier_Cmd) != 0);
 	}
+
+#if WITH_EDITOR
+	void AddKeyRoute(TMap<FKey, uint64>& KeyRoutes, const FInputChord& Chord, EKeyRoute Route)
+	{
+		AddKeyRoute(KeyRoutes, Chord.Key, GetModifierMask(Chord.bShift, Chord.bCtrl, Chord.bAlt, Chord.bCmd), Route);
+	}
+#endif // WITH_EDITOR
 }
 
-bool UImGuiInputHandler::IsToggleInputEvent(const FKeyEvent& KeyEvent) const
+void UImGuiInputHandler::RebuildKeyRoutes()
 {
-	return IsMatchingEvent(KeyEvent, ModuleManager->GetSettings().GetToggleInputKey());
+	KeyRoutes.Reset();
+
+	// Checking modifiers is based on console implementation, which ignores console keys with any modifier down.
+	for (const FKey& Key : GetDefault<UInputSettings>()->ConsoleKeys)
+	{
+		AddKeyRoute(KeyRoutes, Key, 0, KeyRoute_Console);
+	}
+
+#if WITH_EDITOR
+	if (StopPlaySessionCommandInfo.IsValid())
+	{
+#if ENGINE_COMPATIBILITY_SINGLE_KEY_BINDING
+		AddKeyRoute(KeyRoutes, StopPlaySessionCommandInfo->GetActiveChord().Get(), KeyRoute_StopPlaySession);
+#else
+		for (int32 ChordIndex = 0; ChordIndex < static_cast<int32>(EMultipleKeyBindingIndex::NumChords); ChordIndex++)
+		{
+			AddKeyRoute(KeyRoutes, StopPlaySessionCommandInfo->GetActiveChord(static_cast<EMultipleKeyBindingIndex>(ChordIndex)).Get(),
+				KeyRoute_StopPlaySession);
+		}
+#endif
+	}
+#endif // WITH_EDITOR
+
+	const FImGuiKeyInfo& ToggleInputKey = ModuleManager->GetSettings().GetToggleInputKey();
+	for (uint32 ModifierMask = 0; ModifierMask < Modifier_Combinations; ModifierMask++)
+	{
+		if (IsMatchingModifiers(ToggleInputKey, ModifierMask))
+		{
+			AddKeyRoute(KeyRoutes, ToggleInputKey.Key, ModifierMask, KeyRoute_ToggleInput);
+		}
+	}
 }
 
-bool UImGuiInputHandler::HasImGuiActiveItem() const
+void UImGuiInputHandler::OnToggleInputKeyChanged(const FImGuiKeyInfo&)
 {
-	FImGuiContextProxy* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextIndex);
-	return ContextProxy && ContextProxy->HasActiveItem();
+	RebuildKeyRoutes();
 }
 
-void UImGuiInputHandler::UpdateInputStatePointer()
+#if WITH_EDITOR
+void UImGuiInputHandler::OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent&)
 {
-	InputState->SetMousePointer(bMouseInputEnabled && ModuleManager->GetSettings().UseSoftwareCursor());
+	if (Object && Object->IsA<UInputSettings>())
+	{
+		RebuildKeyRoutes();
+	}
 }
 
-void UImGuiInputHandler::OnSoftwareCursorChanged(bool)
+void UImGuiInputHandler::OnUserDefinedChordChanged(const FUICommandInfo& CommandInfo)
 {
-	UpdateInputStatePointer();
+	if (StopPlaySessionCommandInfo.Get() == &CommandInfo)
+	{
+		RebuildKeyRoutes();
+	}
 }
+#endif // WITH_EDITOR
 
 void UImGuiInputHandler::OnPostImGuiUpdate()
 {
@@ -344,7 +464,8 @@ void UImGuiInputHandler::Initialize(FImGuiModuleManager* InModuleManager, UGameV
 
 	auto* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextIndex);
 	checkf(ContextProxy, TEXT("Missing context during initialization of input handler: ContextIndex = %d"), ContextIndex);
-	InputState = &ContextProxy->GetInputState();
+	// Views of worlds sharing a context have their own input states.
+	InputState = &ContextProxy->GetInputState(Utilities::GetWorldContextIndex(InGameViewport ? InGameViewport->GetWorld() : nullptr));
 
 	// Register to get post-update notifications, so we can clean frame updates.
 	ModuleManager->OnPostImGuiUpdate().AddUObject(this, &UImGuiInputHandler::OnPostImGuiUpdate);
@@ -354,6 +475,10 @@ void UImGuiInputHandler::Initialize(FImGuiModuleManager* InModuleManager, UGameV
 	{
 		Settings.OnUseSoftwareCursorChanged.AddUObject(this, &UImGuiInputHandler::OnSoftwareCursorChanged);
 	}
+	if (!Settings.OnToggleInputKeyChanged.IsBoundToObject(this))
+	{
+		Settings.OnToggleInputKeyChanged.AddUObject(this, &UImGuiInputHandler::OnToggleInputKeyChanged);
+	}
 
 #if WITH_EDITOR
 	StopPlaySessionCommandInfo = FInputBindingManager::Get().FindCommandInContext("PlayWorld", "StopPlaySession");
@@ -362,7 +487,13 @@ void UImGuiInputHandler::Initialize(FImGuiModuleManager* InModuleManager, UGameV
 		UE_LOG(LogImGuiInputHandler, Warning, TEXT("Couldn't find 'StopPlaySession' in context 'PlayWorld'. ")
 			TEXT("PIE feature allowing execution of stop command in ImGui input mode will be disabled."));
 	}
+
+	// Routing table needs to follow changes in console keys and in stop play session bindings.
+	FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject(this, &UImGuiInputHandler::OnObjectPropertyChanged);
+	FInputBindingManager::Get().OnUserDefinedChordChanged().AddUObject(this, &UImGuiInputHandler::OnUserDefinedChordChanged);
 #endif // WITH_EDITOR
+
+	RebuildKeyRoutes();
 }
 
 void UImGuiInputHandler::BeginDestroy()
@@ -374,6 +505,12 @@ void UImGuiInputHandler::BeginDestroy()
 	if (ModuleManager && ModuleManager == ImGuiModuleManager)
 	{
 		ModuleManager->GetSettings().OnUseSoftwareCursorChanged.RemoveAll(this);
+		ModuleManager->GetSettings().OnToggleInputKeyChanged.RemoveAll(this);
 	}
+
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectPropertyChanged.RemoveAll(this);
+	FInputBindingManager::Get().OnUserDefinedChordChanged().RemoveAll(this);
+#endif // WITH_EDITOR
 }
 
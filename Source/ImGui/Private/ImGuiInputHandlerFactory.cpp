@@ -7,6 +7,7 @@
 
 #include <Engine/GameViewportClient.h>
 #include <InputCoreTypes.h>
+#include <UObject/Package.h>
 
 
 UImGuiInputHandler* FImGuiInputHandlerFactory::NewHandler(const FSoftClassPath& HandlerClassReference, FImGuiModuleManager* ModuleManager, UGameViewportClient* GameViewport, int32 ContextIndex)
@@ -27,7 +28,10 @@ UImGuiInputHandler* FImGuiInputHandlerFactory::NewHandler(const FSoftClassPath&
 		HandlerClass = UImGuiInputHandler::StaticClass();
 	}
 
-	UImGuiInputHandler* Handler = NewObject<UImGuiInputHandler>(GameViewport, HandlerClass);
+	// Handlers created for editor widgets don't have a game viewport that could own them.
+	UObject* Outer = GameViewport ? static_cast<UObject*>(GameViewport) : GetTransientPackage();
+
+	UImGuiInputHandler* Handler = NewObject<UImGuiInputHandler>(Outer, HandlerClass);
 	if (Handler)
 	{
 		Handler->Initialize(ModuleManager, GameViewport, ContextIndex);
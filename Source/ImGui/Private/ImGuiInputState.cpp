@@ -2,6 +2,8 @@
 
 #include "ImGuiInputState.h"
 
+#include "ImGuiAllocationTracker.h"
+
 #include <algorithm>
 #include <limits>
 #include <type_traits>
@@ -14,6 +16,7 @@ FImGuiInputState::FImGuiInputState()
 
 void FImGuiInputState::AddCharacter(TCHAR Char)
 {
+	IMGUI_TRACK_CONTAINER_GROWTH(InputCharacters);
 	InputCharacters.Add(Char);
 }
 
@@ -52,13 +55,15 @@ void FImGuiInputState::ClearUpdateState()
 	MouseButtonsUpdateRange.SetEmpty();
 
 	MouseWheelDelta = 0.f;
+	bMouseMoved = false;
 
 	bTouchProcessed = bTouchDown;
 }
 
 void FImGuiInputState::ClearCharacters()
 {
-	InputCharacters.Empty();
+	// Keep the allocated memory, so typing doesn't allocate in every frame.
+	InputCharacters.Reset();
 }
 
 void FImGuiInputState::ClearKeys()
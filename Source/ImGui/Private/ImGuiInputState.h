@@ -86,7 +86,11 @@ public:
 
 	// Set the mouse position.
 	// @param Position - Mouse position
-	void SetMousePosition(const FVector2D& Position) { MousePosition = Position; }
+	void SetMousePosition(const FVector2D& Position)
+	{
+		bMouseMoved |= (MousePosition != Position);
+		MousePosition = Position;
+	}
 
 	// Check whether input has active mouse pointer.
 	bool HasMousePointer() const { return bHasMousePointer; }
@@ -208,6 +212,13 @@ public:
 	// and information about dirty parts of keys or mouse buttons arrays.
 	void ClearUpdateState();
 
+	// Check whether any input arrived since the update state was cleared.
+	bool HasUpdates() const
+	{
+		return InputCharacters.Num() > 0 || !KeysUpdateRange.IsEmpty() || !MouseButtonsUpdateRange.IsEmpty()
+			|| MouseWheelDelta != 0.f || bMouseMoved || bTouchDown != bTouchProcessed;
+	}
+
 	TMap<uint32, FKeyEvent> KeyDownEvents;
 	TMap<uint32, FKeyEvent> KeyUpEvents;
 
@@ -237,6 +248,7 @@ private:
 
 	FNavInputArray NavigationInputs;
 
+	bool bMouseMoved = false;
 	bool bHasMousePointer = false;
 	bool bTouchDown = false;
 	bool bTouchProcessed = false;
@@ -407,8 +407,9 @@ namespace ImGuiInterops
 		SetFlag(IO.ConfigFlags, ImGuiConfigFlags_NavEnableGamepad, InputState.IsGamepadNavigationEnabled());
 		SetFlag(IO.BackendFlags, ImGuiBackendFlags_HasGamepad, InputState.HasGamepad());
 
-		// Check whether we need to draw cursor.
-		IO.MouseDrawCursor = InputState.HasMousePointer();
+		// Software cursor is drawn by context proxies in a separate draw list (see FImGuiContextProxy), so mouse movement
+		// doesn't change the main draw data.
+		IO.MouseDrawCursor = false;
 
 		// If touch is enabled and active, give it a precedence.
 		if (InputState.IsTouchActive())
@@ -0,0 +1,28 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiLiteralID.h"
+
+#include <imgui_internal.h>
+
+
+namespace ImGui
+{
+	ImGuiID GetID(const FImGuiLiteralID& ID)
+	{
+		ImGuiContext& g = *GImGui;
+		const ImGuiID Result = ID.Combine(g.CurrentWindow->IDStack.back());
+
+		// Keep the stack tool working, like ImGuiWindow::GetID does for strings.
+		if (g.DebugHookIdInfo == Result)
+		{
+			DebugHookIdInfo(Result, ImGuiDataType_String, ID.Label, nullptr);
+		}
+
+		return Result;
+	}
+
+	void PushID(const FImGuiLiteralID& ID)
+	{
+		GImGui->CurrentWindow->IDStack.push_back(GetID(ID));
+	}
+}
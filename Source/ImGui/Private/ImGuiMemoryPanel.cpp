@@ -0,0 +1,213 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiMemoryPanel.h"
+
+#include "ImGuiModuleProperties.h"
+
+#include <imgui_internal.h>
+
+
+namespace
+{
+	// Columns of the series table, also used as their user IDs in sort specs.
+	enum class ESeriesColumn : ImGuiID
+	{
+		Name,
+		Current,
+		Peak,
+		Change
+	};
+
+	constexpr float PlotHeight = 120.f;
+
+	float GetChange(const FImGuiMemorySampler& Sampler, const FImGuiMemorySampler::FSeries& Series)
+	{
+		const int32 NumSamples = Sampler.GetNumSamples();
+		return (NumSamples > 0) ? Sampler.GetHistoryValue(Series, NumSamples - 1) - Sampler.GetHistoryValue(Series, 0) : 0.f;
+	}
+
+	float GetColumnValue(const FImGuiMemorySampler& Sampler, const FImGuiMemorySampler::FSeries& Series, ESeriesColumn Column)
+	{
+		switch (Column)
+		{
+		case ESeriesColumn::Current: return Series.Current;
+		case ESeriesColumn::Peak: return Series.Peak;
+		case ESeriesColumn::Change: return GetChange(Sampler, Series);
+		default: return 0.f;
+		}
+	}
+
+	// Reduce history to at most one value per pixel. Every output value is a maximum of its bucket, so short spikes are
+	// still visible after decimation.
+	void DecimateHistory(const FImGuiMemorySampler& Sampler, const FImGuiMemorySampler::FSeries& Series, int32 MaxValues,
+		TArray<float>& OutValues)
+	{
+		const int32 NumSamples = Sampler.GetNumSamples();
+		const int32 NumValues = FMath::Min(NumSamples, FMath::Max(MaxValues, 1));
+
+		OutValues.Reset(NumValues);
+		for (int32 ValueIndex = 0; ValueIndex < NumValues; ValueIndex++)
+		{
+			const int32 First = static_cast<int32>(static_cast<int64>(ValueIndex) * NumSamples / NumValues);
+			const int32 Last = static_cast<int32>(static_cast<int64>(ValueIndex + 1) * NumSamples / NumValues);
+
+			float Value = Sampler.GetHistoryValue(Series, First);
+			for (int32 SampleIndex = First + 1; SampleIndex < Last; SampleIndex++)
+			{
+				Value = FMath::Max(Value, Sampler.GetHistoryValue(Series, SampleIndex));
+			}
+			OutValues.Add(Value);
+		}
+	}
+}
+
+void FImGuiMemoryPanel::Tick()
+{
+	if (Properties.ShowMemory())
+	{
+		Sampler.Update();
+	}
+}
+
+void FImGuiMemoryPanel::DrawControls(int32 ContextIndex)
+{
+	if (Properties.ShowMemory())
+	{
+		bool bOpen = true;
+		ImGui::SetNextWindowSize(ImVec2(620, 500), ImGuiCond_FirstUseEver);
+		if (ImGui::Begin("ImGui Memory", &bOpen))
+		{
+			const float SampleRate = Sampler.GetSampleRate();
+			ImGui::Text("Samples: %d / %d at %.1f Hz", Sampler.GetNumSamples(), FImGuiMemorySampler::HistoryCapacity, SampleRate);
+			ImGui::Text("Sample Time: %.3f ms (avg %.3f ms, %.3f%% of a thread)", Sampler.GetLastSampleTime() * 1000.0,
+				Sampler.GetAverageSampleTime() * 1000.0, Sampler.GetAverageSampleTime() * SampleRate * 100.0);
+
+			if (!Sampler.IsTrackingLLM())
+			{
+				ImGui::TextDisabled("LLM is disabled, only platform stats are sampled (run with -LLM to track tags).");
+			}
+
+			if (ImGui::Button("Reset"))
+			{
+				Sampler.Reset();
+			}
+			ImGui::SameLine();
+			ImGui::Checkbox("Show Empty", &bShowEmpty);
+			ImGui::SameLine();
+			Filter.Draw("Filter", 200.f);
+
+			DrawSeriesTable();
+
+			const TArray<FImGuiMemorySampler::FSeries>& Series = Sampler.GetSeries();
+			if (Series.IsValidIndex(SelectedSeries))
+			{
+				DrawHistoryPlot(Series[SelectedSeries]);
+			}
+		}
+		ImGui::End();
+
+		if (!bOpen)
+		{
+			Properties.SetShowMemory(false);
+		}
+	}
+}
+
+void FImGuiMemoryPanel::DrawSeriesTable()
+{
+	const TArray<FImGuiMemorySampler::FSeries>& Series = Sampler.GetSeries();
+
+	constexpr ImGuiTableFlags TableFlags = ImGuiTableFlags_Sortable | ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg
+		| ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY | ImGuiTableFlags_SizingFixedFit;
+
+	// Leave space for the history plot below the table.
+	const ImVec2 TableSize{ 0.f, -(PlotHeight + ImGui::GetFrameHeightWithSpacing() * 2.f) };
+
+	if (ImGui::BeginTable("Series", 4, TableFlags, TableSize))
+	{
+		ImGui::TableSetupScrollFreeze(0, 1);
+		ImGui::TableSetupColumn("Tag", ImGuiTableColumnFlags_WidthStretch, 0.f, static_cast<ImGuiID>(ESeriesColumn::Name));
+		ImGui::TableSetupColumn("Current MB", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_PreferSortDescending, 0.f, static_cast<ImGuiID>(ESeriesColumn::Current));
+		ImGui::TableSetupColumn("Peak MB", ImGuiTableColumnFlags_PreferSortDescending, 0.f, static_cast<ImGuiID>(ESeriesColumn::Peak));
+		ImGui::TableSetupColumn("Change MB", ImGuiTableColumnFlags_PreferSortDescending, 0.f, static_cast<ImGuiID>(ESeriesColumn::Change));
+		ImGui::TableHeadersRow();
+
+		// Collect series to show.
+		SortedSeries.Reset();
+		for (int32 Index = 0; Index < Series.Num(); Index++)
+		{
+			if ((bShowEmpty || Series[Index].Peak > 0) && Filter.PassFilter(TCHAR_TO_UTF8(*Series[Index].Name)))
+			{
+				SortedSeries.Add(Index);
+			}
+		}
+
+		// Sort by the selected column. We sort every frame, because values are constantly changing.
+		ESeriesColumn SortColumn = ESeriesColumn::Current;
+		bool bAscending = false;
+		if (const ImGuiTableSortSpecs* SortSpecs = ImGui::TableGetSortSpecs())
+		{
+			if (SortSpecs->SpecsCount > 0)
+			{
+				SortColumn = static_cast<ESeriesColumn>(SortSpecs->Specs[0].ColumnUserID);
+				bAscending = (SortSpecs->Specs[0].SortDirection == ImGuiSortDirection_Ascending);
+			}
+		}
+
+		SortedSeries.Sort([&](int32 A, int32 B)
+		{
+			if (SortColumn == ESeriesColumn::Name)
+			{
+				return bAscending ? Series[A].Name < Series[B].Name : Series[B].Name < Series[A].Name;
+			}
+
+			const float ValueA = GetColumnValue(Sampler, Series[A], SortColumn);
+			const float ValueB = GetColumnValue(Sampler, Series[B], SortColumn);
+			return bAscending ? ValueA < ValueB : ValueA > ValueB;
+		});
+
+		// Only visible rows are drawn.
+		ImGuiListClipper Clipper;
+		Clipper.Begin(SortedSeries.Num());
+		while (Clipper.Step())
+		{
+			for (int32 Row = Clipper.DisplayStart; Row < Clipper.DisplayEnd; Row++)
+			{
+				const int32 SeriesIndex = SortedSeries[Row];
+				const FImGuiMemorySampler::FSeries& Entry = Series[SeriesIndex];
+
+				ImGui::TableNextRow();
+
+				ImGui::TableNextColumn();
+				ImGui::PushID(SeriesIndex);
+				if (ImGui::Selectable(TCHAR_TO_UTF8(*Entry.Name), SeriesIndex == SelectedSeries, ImGuiSelectableFlags_SpanAllColumns))
+				{
+					SelectedSeries = SeriesIndex;
+				}
+				ImGui::PopID();
+
+				ImGui::TableNextColumn();
+				ImGui::Text("%.2f", Entry.Current / (1024.0 * 1024.0));
+				ImGui::TableNextColumn();
+				ImGui::Text("%.2f", Entry.Peak / (1024.0 * 1024.0));
+				ImGui::TableNextColumn();
+				ImGui::Text("%+.2f", GetChange(Sampler, Entry));
+			}
+		}
+
+		ImGui::EndTable();
+	}
+}
+
+void FImGuiMemoryPanel::DrawHistoryPlot(const FImGuiMemorySampler::FSeries& Series)
+{
+	const float Width = ImGui::GetContentRegionAvail().x;
+	DecimateHistory(Sampler, Series, static_cast<int32>(Width), PlotValues);
+
+	char Overlay[64];
+	ImFormatString(Overlay, IM_ARRAYSIZE(Overlay), "%.2f MB (peak %.2f MB)", Series.Current / (1024.0 * 1024.0),
+		Series.Peak / (1024.0 * 1024.0));
+
+	ImGui::TextUnformatted(TCHAR_TO_UTF8(*Series.Name));
+	ImGui::PlotLines("##History", PlotValues.GetData(), PlotValues.Num(), 0, Overlay, FLT_MAX, FLT_MAX, ImVec2(Width, PlotHeight));
+}
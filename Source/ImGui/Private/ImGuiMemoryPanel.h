@@ -0,0 +1,45 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "ImGuiMemorySampler.h"
+
+#include <CoreMinimal.h>
+
+#include <imgui.h>
+
+class FImGuiModuleProperties;
+
+// Widget drawing live memory stats with a sortable table of LLM tags and history plots of the selected tag.
+class FImGuiMemoryPanel
+{
+public:
+
+	FImGuiMemoryPanel(FImGuiModuleProperties& InProperties)
+		: Properties(InProperties)
+	{
+	}
+
+	// Update sampling. Memory is only sampled while the panel is open.
+	void Tick();
+
+	void DrawControls(int32 ContextIndex);
+
+private:
+
+	void DrawSeriesTable();
+	void DrawHistoryPlot(const FImGuiMemorySampler::FSeries& Series);
+
+	FImGuiModuleProperties& Properties;
+
+	FImGuiMemorySampler Sampler;
+
+	ImGuiTextFilter Filter;
+
+	// Buffers reused to sort series and to decimate history.
+	TArray<int32> SortedSeries;
+	TArray<float> PlotValues;
+
+	int32 SelectedSeries = 0;
+	bool bShowEmpty = false;
+};
@@ -0,0 +1,161 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiMemorySampler.h"
+
+#include <Async/Async.h>
+#include <HAL/IConsoleManager.h>
+#include <HAL/LowLevelMemTracker.h>
+#include <HAL/PlatformMemory.h>
+#include <HAL/PlatformTime.h>
+
+
+namespace CVars
+{
+	TAutoConsoleVariable<float> MemorySampleRate(TEXT("ImGui.Memory.SampleRate"), 4.f,
+		TEXT("Number of memory samples per second taken while the ImGui memory panel is open (0.1 - 60)."),
+		ECVF_Default);
+}
+
+namespace
+{
+	// Platform stats sampled before LLM tags.
+	const TCHAR* const PlatformSeriesNames[] =
+	{
+		TEXT("Platform: Used Physical"),
+		TEXT("Platform: Used Virtual"),
+		TEXT("Platform: Available Physical"),
+	};
+
+	constexpr int32 NumPlatformSeries = UE_ARRAY_COUNT(PlatformSeriesNames);
+
+	// Weight of a new sample in the running average of sample time.
+	constexpr double AverageWeight = 0.1;
+
+	float ToMegabytes(int64 Bytes)
+	{
+		return static_cast<float>(Bytes / (1024.0 * 1024.0));
+	}
+}
+
+FImGuiMemorySampler::FImGuiMemorySampler()
+{
+	for (const TCHAR* Name : PlatformSeriesNames)
+	{
+		FSeries& NewSeries = Series.AddDefaulted_GetRef();
+		NewSeries.Name = Name;
+		NewSeries.bPlatform = true;
+	}
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	// Only generic tags are listed, as those are the same on all platforms and engine versions.
+	if (FLowLevelMemTracker::IsEnabled())
+	{
+		for (int32 Tag = 0; Tag < static_cast<int32>(ELLMTag::GenericTagCount); Tag++)
+		{
+			if (const TCHAR* TagName = LLMGetTagName(static_cast<ELLMTag>(Tag)))
+			{
+				LLMTags.Add(Tag);
+				Series.AddDefaulted_GetRef().Name = TagName;
+			}
+		}
+	}
+#endif // ENABLE_LOW_LEVEL_MEM_TRACKER
+
+	for (FSeries& Entry : Series)
+	{
+		Entry.History.SetNumZeroed(HistoryCapacity);
+	}
+}
+
+FImGuiMemorySampler::~FImGuiMemorySampler()
+{
+	if (SampleTask.IsValid())
+	{
+		SampleTask.Wait();
+	}
+}
+
+void FImGuiMemorySampler::Update()
+{
+	if (SampleTask.IsValid() && SampleTask.IsReady())
+	{
+		AddSample(SampleTask.Get());
+		SampleTask.Reset();
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (!SampleTask.IsValid() && Now >= NextSampleTime)
+	{
+		NextSampleTime = Now + 1.0 / GetSampleRate();
+		SampleTask = Async(EAsyncExecution::ThreadPool, [Tags = LLMTags]() { return TakeSample(Tags); });
+	}
+}
+
+void FImGuiMemorySampler::Reset()
+{
+	for (FSeries& Entry : Series)
+	{
+		Entry.Current = 0;
+		Entry.Peak = 0;
+		FMemory::Memzero(Entry.History.GetData(), Entry.History.Num() * sizeof(float));
+	}
+
+	Head = 0;
+	NumSamples = 0;
+}
+
+float FImGuiMemorySampler::GetHistoryValue(const FSeries& InSeries, int32 SampleIndex) const
+{
+	checkf(SampleIndex >= 0 && SampleIndex < NumSamples, TEXT("Sample index out of range: SampleIndex = %d, NumSamples = %d"),
+		SampleIndex, NumSamples);
+	return InSeries.History[(Head - NumSamples + SampleIndex + HistoryCapacity) % HistoryCapacity];
+}
+
+float FImGuiMemorySampler::GetSampleRate() const
+{
+	return FMath::Clamp(CVars::MemorySampleRate.GetValueOnGameThread(), 0.1f, 60.f);
+}
+
+FImGuiMemorySampler::FSample FImGuiMemorySampler::TakeSample(const TArray<int32>& Tags)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	FSample Sample;
+	Sample.Values.Reserve(NumPlatformSeries + Tags.Num());
+
+	const FPlatformMemoryStats Stats = FPlatformMemory::GetStats();
+	Sample.Values.Add(Stats.UsedPhysical);
+	Sample.Values.Add(Stats.UsedVirtual);
+	Sample.Values.Add(Stats.AvailablePhysical);
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	FLowLevelMemTracker& Tracker = FLowLevelMemTracker::Get();
+	for (int32 Tag : Tags)
+	{
+		Sample.Values.Add(Tracker.GetTagAmountForTracker(ELLMTracker::Default, static_cast<ELLMTag>(Tag)));
+	}
+#endif // ENABLE_LOW_LEVEL_MEM_TRACKER
+
+	Sample.Duration = FPlatformTime::Seconds() - StartTime;
+	return Sample;
+}
+
+void FImGuiMemorySampler::AddSample(const FSample& Sample)
+{
+	checkf(Sample.Values.Num() == Series.Num(), TEXT("Sample doesn't match series: Values = %d, Series = %d"),
+		Sample.Values.Num(), Series.Num());
+
+	for (int32 Index = 0; Index < Series.Num(); Index++)
+	{
+		FSeries& Entry = Series[Index];
+		Entry.Current = Sample.Values[Index];
+		Entry.Peak = FMath::Max(Entry.Peak, Entry.Current);
+		Entry.History[Head] = ToMegabytes(Entry.Current);
+	}
+
+	Head = (Head + 1) % HistoryCapacity;
+	NumSamples = FMath::Min(NumSamples + 1, HistoryCapacity);
+
+	LastSampleTime = Sample.Duration;
+	AverageSampleTime = (AverageSampleTime > 0.0) ? FMath::Lerp(AverageSampleTime, Sample.Duration, AverageWeight) : Sample.Duration;
+}
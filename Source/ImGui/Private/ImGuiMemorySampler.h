@@ -0,0 +1,97 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Async/Future.h>
+
+
+// Samples platform memory stats and Low-Level Memory Tracker tags (if LLM is enabled) and keeps their history in
+// fixed ring buffers. Samples are taken on a background task at a rate defined by the ImGui.Memory.SampleRate console
+// variable. At most one task is in flight and its result is collected in a later update, so the game thread never
+// waits for sampling.
+class FImGuiMemorySampler
+{
+public:
+
+	// Number of samples kept in history of every series.
+	static constexpr int32 HistoryCapacity = 1024;
+
+	struct FSeries
+	{
+		FString Name;
+
+		// Values in the last sample and the highest value since sampling started (in bytes).
+		int64 Current = 0;
+		int64 Peak = 0;
+
+		// Ring buffer with values in megabytes (see GetHistoryValue).
+		TArray<float> History;
+
+		// Whether this series comes from platform stats rather than from LLM.
+		bool bPlatform = false;
+	};
+
+	FImGuiMemorySampler();
+	~FImGuiMemorySampler();
+
+	FImGuiMemorySampler(const FImGuiMemorySampler&) = delete;
+	FImGuiMemorySampler& operator=(const FImGuiMemorySampler&) = delete;
+
+	FImGuiMemorySampler(FImGuiMemorySampler&&) = delete;
+	FImGuiMemorySampler& operator=(FImGuiMemorySampler&&) = delete;
+
+	// Collect a finished sample and start a new one if it is time. Should be called on the game thread.
+	void Update();
+
+	// Clear history and peaks.
+	void Reset();
+
+	// Get all sampled series. Platform series are first.
+	const TArray<FSeries>& GetSeries() const { return Series; }
+
+	// Get the number of samples in history.
+	int32 GetNumSamples() const { return NumSamples; }
+
+	// Get a value from history of a series in megabytes.
+	// @param InSeries - Series from this sampler
+	// @param SampleIndex - Index of a sample, where 0 is the oldest sample in history
+	float GetHistoryValue(const FSeries& InSeries, int32 SampleIndex) const;
+
+	// Whether LLM tags are sampled (requires running with -LLM).
+	bool IsTrackingLLM() const { return LLMTags.Num() > 0; }
+
+	// Get time spent taking the last sample and the running average of that time (in seconds).
+	double GetLastSampleTime() const { return LastSampleTime; }
+	double GetAverageSampleTime() const { return AverageSampleTime; }
+
+	// Get the current sample rate (in samples per second).
+	float GetSampleRate() const;
+
+private:
+
+	struct FSample
+	{
+		TArray<int64> Values;
+		double Duration = 0.0;
+	};
+
+	static FSample TakeSample(const TArray<int32>& Tags);
+
+	void AddSample(const FSample& Sample);
+
+	TArray<FSeries> Series;
+
+	// Tracked LLM tags, in the same order as their series.
+	TArray<int32> LLMTags;
+
+	// Position of the next sample in ring buffers.
+	int32 Head = 0;
+	int32 NumSamples = 0;
+
+	TFuture<FSample> SampleTask;
+	double NextSampleTime = 0.0;
+
+	double LastSampleTime = 0.0;
+	double AverageSampleTime = 0.0;
+};
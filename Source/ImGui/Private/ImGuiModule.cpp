@@ -3,12 +3,14 @@
 #include "ImGuiModule.h"
 
 #include "ImGuiDelegatesContainer.h"
+#include "ImGuiFileWriter.h"
+#include "ImGuiImplementation.h"
+#include "ImGuiModuleDebug.h"
 #include "ImGuiModuleManager.h"
 #include "TextureManager.h"
 #include "Utilities/WorldContextIndex.h"
 
 #if WITH_EDITOR
-#include "ImGuiImplementation.h"
 #include "Editor/ImGuiEditor.h"
 #endif
 
@@ -18,6 +20,23 @@
 #define LOCTEXT_NAMESPACE "FImGuiModule"
 
 
+DEFINE_STAT(STAT_ImGuiContextUpdate);
+DEFINE_STAT(STAT_ImGuiWidgetPaint);
+DEFINE_STAT(STAT_ImGuiDrawElements);
+DEFINE_STAT(STAT_ImGuiVertices);
+DEFINE_STAT(STAT_ImGuiIndices);
+DEFINE_STAT(STAT_ImGuiSubmittedBytes);
+DEFINE_STAT(STAT_ImGuiOccludedWindows);
+DEFINE_STAT(STAT_ImGuiOccludedVertices);
+DEFINE_STAT(STAT_ImGuiConvertedVertices);
+DEFINE_STAT(STAT_ImGuiSkippedPanels);
+DEFINE_STAT(STAT_ImGuiAllocations);
+DEFINE_STAT(STAT_ImGuiContainerAllocations);
+DEFINE_STAT(STAT_ImGuiDebugDrawBatching);
+DEFINE_STAT(STAT_ImGuiDebugLines);
+DEFINE_STAT(STAT_ImGuiCulledDebugLines);
+
+
 struct EDelegateCategory
 {
 	enum
@@ -111,8 +130,17 @@ void FImGuiModule::RebuildFontAtlas()
 	}
 }
 
+ImFont* FImGuiModule::GetFont(FName FontName)
+{
+	return ImGuiModuleManager ? ImGuiModuleManager->GetContextManager().GetFont(FontName) : nullptr;
+}
+
 void FImGuiModule::StartupModule()
 {
+	// Track ImGui memory. Every instance of the module uses the same allocation scheme, so memory can be safely
+	// released by the module that replaced the one that allocated it.
+	ImGuiImplementation::InitializeAllocator();
+
 	// Initialize handles to allow cross-module redirections. Other handles will always look for parents in the active
 	// module, which means that we can only redirect to started modules. We don't have to worry about self-referencing
 	// as local handles are guaranteed to be constructed before initializing pointers.
@@ -132,7 +160,7 @@ void FImGuiModule::StartupModule()
 
 #if WITH_EDITOR
 	checkf(!ImGuiEditor, TEXT("Instance of the ImGui Editor already exists. Instance should be created only during module startup."));
-	ImGuiEditor = new FImGuiEditor();
+	ImGuiEditor = new FImGuiEditor(*ImGuiModuleManager);
 #endif
 }
 
@@ -157,6 +185,9 @@ void FImGuiModule::ShutdownModule()
 	delete ImGuiModuleManager;
 	ImGuiModuleManager = nullptr;
 
+	// Contexts save their settings when destroyed, so files are flushed after that.
+	FImGuiFileWriter::Shutdown();
+
 #if WITH_EDITOR
 	// When shutting down we leave the global ImGui context pointer and handle pointing to resources that are already
 	// deleted. This can cause troubles after hot-reload when code in other modules calls ImGui interface functions
@@ -14,6 +14,10 @@ const TCHAR* const FImGuiModuleCommands::ToggleGamepadInputSharing = TEXT("ImGui
 const TCHAR* const FImGuiModuleCommands::ToggleMouseInputSharing = TEXT("ImGui.ToggleMouseInputSharing");
 const TCHAR* const FImGuiModuleCommands::SetMouseInputSharing = TEXT("ImGui.SetMouseInputSharing");
 const TCHAR* const FImGuiModuleCommands::ToggleDemo = TEXT("ImGui.ToggleDemo");
+const TCHAR* const FImGuiModuleCommands::ToggleStats = TEXT("ImGui.ToggleStats");
+const TCHAR* const FImGuiModuleCommands::ToggleMemory = TEXT("ImGui.ToggleMemory");
+const TCHAR* const FImGuiModuleCommands::ToggleCommandPalette = TEXT("ImGui.ToggleCommandPalette");
+const TCHAR* const FImGuiModuleCommands::CompactMemory = TEXT("ImGui.CompactMemory");
 
 FImGuiModuleCommands::FImGuiModuleCommands(FImGuiModuleProperties& InProperties)
 	: Properties(InProperties)
@@ -41,6 +45,18 @@ FImGuiModuleCommands::FImGuiModuleCommands(FImGuiModuleProperties& InProperties)
 	, ToggleDemoCommand(ToggleDemo,
 		TEXT("Toggle ImGui demo."),
 		FConsoleCommandDelegate::CreateRaw(this, &FImGuiModuleCommands::ToggleDemoImpl))
+	, ToggleStatsCommand(ToggleStats,
+		TEXT("Toggle ImGui stats with the most expensive windows."),
+		FConsoleCommandDelegate::CreateRaw(this, &FImGuiModuleCommands::ToggleStatsImpl))
+	, ToggleMemoryCommand(ToggleMemory,
+		TEXT("Toggle ImGui memory panel with live platform and LLM memory stats."),
+		FConsoleCommandDelegate::CreateRaw(this, &FImGuiModuleCommands::ToggleMemoryImpl))
+	, ToggleCommandPaletteCommand(ToggleCommandPalette,
+		TEXT("Toggle ImGui command palette that finds windows, console commands and variables."),
+		FConsoleCommandDelegate::CreateRaw(this, &FImGuiModuleCommands::ToggleCommandPaletteImpl))
+	, CompactMemoryCommand(CompactMemory,
+		TEXT("Release transient ImGui buffers in all contexts and widgets and log reclaimed memory."),
+		FConsoleCommandDelegate::CreateRaw(this, &FImGuiModuleCommands::CompactMemoryImpl))
 {
 }
 
@@ -93,3 +109,23 @@ void FImGuiModuleCommands::ToggleDemoImpl()
 {
 	Properties.ToggleDemo();
 }
+
+void FImGuiModuleCommands::ToggleStatsImpl()
+{
+	Properties.ToggleStats();
+}
+
+void FImGuiModuleCommands::ToggleMemoryImpl()
+{
+	Properties.ToggleMemory();
+}
+
+void FImGuiModuleCommands::ToggleCommandPaletteImpl()
+{
+	Properties.ToggleCommandPalette();
+}
+
+void FImGuiModuleCommands::CompactMemoryImpl()
+{
+	OnCompactMemory.Broadcast();
+}
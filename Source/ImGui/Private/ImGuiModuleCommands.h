@@ -21,11 +21,18 @@ public:
 	static const TCHAR* const ToggleMouseInputSharing;
 	static const TCHAR* const SetMouseInputSharing;
 	static const TCHAR* const ToggleDemo;
+	static const TCHAR* const ToggleStats;
+	static const TCHAR* const ToggleMemory;
+	static const TCHAR* const ToggleCommandPalette;
+	static const TCHAR* const CompactMemory;
 
 	FImGuiModuleCommands(FImGuiModuleProperties& InProperties);
 
 	void SetKeyBinding(const TCHAR* CommandName, const FImGuiKeyInfo& KeyInfo);
 
+	// Delegate raised to execute 'ImGui.CompactMemory' command.
+	FSimpleMulticastDelegate OnCompactMemory;
+
 private:
 
 	void ToggleInputImpl();
@@ -36,6 +43,10 @@ private:
 	void ToggleMouseInputSharingImpl();
 	void SetMouseInputSharingImpl(const TArray< FString >& Args);
 	void ToggleDemoImpl();
+	void ToggleStatsImpl();
+	void ToggleMemoryImpl();
+	void ToggleCommandPaletteImpl();
+	void CompactMemoryImpl();
 
 	FImGuiModuleProperties& Properties;
 
@@ -47,4 +58,8 @@ private:
 	FAutoConsoleCommand ToggleMouseInputSharingCommand;
 	FAutoConsoleCommand SetMouseInputSharingCommand;
 	FAutoConsoleCommand ToggleDemoCommand;
+	FAutoConsoleCommand ToggleStatsCommand;
+	FAutoConsoleCommand ToggleMemoryCommand;
+	FAutoConsoleCommand ToggleCommandPaletteCommand;
+	FAutoConsoleCommand CompactMemoryCommand;
 };
@@ -3,6 +3,8 @@
 #pragma once
 
 #include <Logging/LogMacros.h>
+#include <Rendering/RenderingCommon.h>
+#include <Stats/Stats.h>
 
 
 // Module-wide debug symbols and loggers.
@@ -14,3 +16,54 @@
 
 // Input Handler logger (used also in non-developer mode to raise problems with handler extensions).
 DECLARE_LOG_CATEGORY_EXTERN(LogImGuiInputHandler, Warning, All);
+
+
+// Stats describing the cost of ImGui contexts and widgets. Counters show data that widgets submit to the Slate renderer,
+// which drive the render thread cost of batching, uploading and drawing ImGui elements. Every draw element needs to be
+// batched separately and typically ends up as one draw call, because neighbouring elements use different clipping.
+DECLARE_STATS_GROUP(TEXT("ImGui"), STATGROUP_ImGui, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Context Update"), STAT_ImGuiContextUpdate, STATGROUP_ImGui, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Widget Paint"), STAT_ImGuiWidgetPaint, STATGROUP_ImGui, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Draw Elements"), STAT_ImGuiDrawElements, STATGROUP_ImGui, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Vertices"), STAT_ImGuiVertices, STATGROUP_ImGui, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Indices"), STAT_ImGuiIndices, STATGROUP_ImGui, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Submitted Bytes"), STAT_ImGuiSubmittedBytes, STATGROUP_ImGui, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Occluded Windows"), STAT_ImGuiOccludedWindows, STATGROUP_ImGui, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Occluded Vertices"), STAT_ImGuiOccludedVertices, STATGROUP_ImGui, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Converted Vertices"), STAT_ImGuiConvertedVertices, STATGROUP_ImGui, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Skipped Panels"), STAT_ImGuiSkippedPanels, STATGROUP_ImGui, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("ImGui Allocations"), STAT_ImGuiAllocations, STATGROUP_ImGui, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Container Allocations"), STAT_ImGuiContainerAllocations, STATGROUP_ImGui, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Debug Draw Batching"), STAT_ImGuiDebugDrawBatching, STATGROUP_ImGui, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Debug Lines"), STAT_ImGuiDebugLines, STATGROUP_ImGui, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Culled Debug Lines"), STAT_ImGuiCulledDebugLines, STATGROUP_ImGui, );
+
+// Accumulates data submitted to Slate during one widget paint and adds it to stats when going out of scope.
+struct FImGuiPaintStatsScope
+{
+#if STATS
+	FORCEINLINE void AddElement(int32 NumVertices, int32 NumIndices)
+	{
+		Elements++;
+		Vertices += NumVertices;
+		Indices += NumIndices;
+	}
+
+	~FImGuiPaintStatsScope()
+	{
+		INC_DWORD_STAT_BY(STAT_ImGuiDrawElements, Elements);
+		INC_DWORD_STAT_BY(STAT_ImGuiVertices, Vertices);
+		INC_DWORD_STAT_BY(STAT_ImGuiIndices, Indices);
+		INC_DWORD_STAT_BY(STAT_ImGuiSubmittedBytes, Vertices * sizeof(FSlateVertex) + Indices * sizeof(SlateIndex));
+	}
+
+private:
+
+	uint32 Elements = 0;
+	uint32 Vertices = 0;
+	uint32 Indices = 0;
+#else
+	FORCEINLINE void AddElement(int32, int32) {}
+#endif // STATS
+};
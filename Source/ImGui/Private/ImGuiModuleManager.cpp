@@ -2,15 +2,20 @@
 
 #include "ImGuiModuleManager.h"
 
+#include "ImGuiAllocationTracker.h"
+#include "ImGuiImplementation.h"
 #include "ImGuiInteroperability.h"
 #include "Utilities/WorldContextIndex.h"
 
 #include <Framework/Application/SlateApplication.h>
 #include <Modules/ModuleManager.h>
+#include <UObject/UObjectGlobals.h>
 
 #include <imgui.h>
 
 
+DEFINE_LOG_CATEGORY_STATIC(LogImGuiMemory, Log, All);
+
 // High enough z-order guarantees that ImGui output is rendered on top of the game UI.
 constexpr int32 IMGUI_WIDGET_Z_ORDER = 10000;
 
@@ -23,10 +28,17 @@ FImGuiModuleManager::FImGuiModuleManager()
 	, Settings(Properties, Commands)
 	, ImGuiDemo(Properties)
 	, ContextManager(Settings)
+	, StatsPanel(Properties, ContextManager)
+	, MemoryPanel(Properties)
+	, CommandPalette(Properties)
 {
 	// Register in context manager to get information whenever a new context proxy is created.
 	ContextManager.OnContextProxyCreated.AddRaw(this, &FImGuiModuleManager::OnContextProxyCreated);
 
+	// Compact memory on demand or optionally after loading a map.
+	Commands.OnCompactMemory.AddRaw(this, &FImGuiModuleManager::CompactMemory);
+	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddRaw(this, &FImGuiModuleManager::OnPostLoadMap);
+
 	// Typically we will use viewport created events to add widget to new game viewports.
 	ViewportCreatedHandle = UGameViewportClient::OnViewportCreated().AddRaw(this, &FImGuiModuleManager::OnViewportCreated);
 
@@ -47,6 +59,13 @@ FImGuiModuleManager::FImGuiModuleManager()
 FImGuiModuleManager::~FImGuiModuleManager()
 {
 	ContextManager.OnFontAtlasBuilt.RemoveAll(this);
+	Commands.OnCompactMemory.RemoveAll(this);
+
+	if (PostLoadMapHandle.IsValid())
+	{
+		FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+		PostLoadMapHandle.Reset();
+	}
 
 	// We are no longer interested with adding widgets to viewports.
 	if (ViewportCreatedHandle.IsValid())
@@ -79,6 +98,27 @@ void FImGuiModuleManager::RebuildFontAtlas()
 	ContextManager.RebuildFontAtlas();
 }
 
+void FImGuiModuleManager::CompactMemory()
+{
+	const int64 ImGuiBytesBefore = ImGuiImplementation::GetAllocatedBytes();
+	ContextManager.CompactMemory();
+	const int64 ImGuiBytesReclaimed = ImGuiBytesBefore - ImGuiImplementation::GetAllocatedBytes();
+
+	int64 WidgetBytesReclaimed = 0;
+	CompactMemoryEvent.Broadcast(WidgetBytesReclaimed);
+
+	UE_LOG(LogImGuiMemory, Log, TEXT("Compacted ImGui memory: %.1f KB released by contexts, %.1f KB by widgets, %.1f KB still allocated by ImGui (more can be released in the next frame)."),
+		ImGuiBytesReclaimed / 1024.0, WidgetBytesReclaimed / 1024.0, ImGuiImplementation::GetAllocatedBytes() / 1024.0);
+}
+
+void FImGuiModuleManager::OnPostLoadMap(UWorld* World)
+{
+	if (Settings.ShouldCompactMemoryOnMapLoad())
+	{
+		CompactMemory();
+	}
+}
+
 void FImGuiModuleManager::LoadTextures()
 {
 	checkf(FSlateApplication::IsInitialized(), TEXT("Slate should be initialized before we can create textures."));
@@ -172,8 +212,14 @@ void FImGuiModuleManager::Tick(float DeltaSeconds)
 		// Update context manager to advance all ImGui contexts to the next frame.
 		ContextManager.Tick(DeltaSeconds);
 
+		// Collect memory samples taken in the background.
+		MemoryPanel.Tick();
+
 		// Inform that we finished updating ImGui, so other subsystems can react.
 		PostImGuiUpdateEvent.Broadcast();
+
+		// Frames are counted between ticks, so allocations made while painting widgets are included.
+		ImGuiAllocationTracker::EndFrame();
 	}
 }
 
@@ -236,5 +282,10 @@ void FImGuiModuleManager::AddWidgetsToActiveViewports()
 
 void FImGuiModuleManager::OnContextProxyCreated(int32 ContextIndex, FImGuiContextProxy& ContextProxy)
 {
+	CommandPalette.ResetContext(ContextIndex);
+
 	ContextProxy.OnDraw().AddLambda([this, ContextIndex]() { ImGuiDemo.DrawControls(ContextIndex); });
+	ContextProxy.OnDraw().AddLambda([this, ContextIndex]() { StatsPanel.DrawControls(ContextIndex); });
+	ContextProxy.OnDraw().AddLambda([this, ContextIndex]() { MemoryPanel.DrawControls(ContextIndex); });
+	ContextProxy.OnDraw().AddLambda([this, ContextIndex]() { CommandPalette.DrawControls(ContextIndex); });
 }
@@ -2,15 +2,23 @@
 
 #pragma once
 
+#include "ImGuiCommandPalette.h"
 #include "ImGuiContextManager.h"
+#include "ImGuiDebugDrawBatcher.h"
 #include "ImGuiDemo.h"
+#include "ImGuiMemoryPanel.h"
 #include "ImGuiModuleCommands.h"
 #include "ImGuiModuleProperties.h"
 #include "ImGuiModuleSettings.h"
+#include "ImGuiStatsPanel.h"
 #include "TextureManager.h"
 #include "Widgets/SImGuiLayout.h"
 
 
+// Delegate called when memory is compacted.
+// @param InOutReclaimedBytes - Counter to which listeners should add the number of bytes that they released
+DECLARE_MULTICAST_DELEGATE_OneParam(FCompactMemoryDelegate, int64&);
+
 // Central manager that implements module logic. It initializes and controls remaining module components.
 class FImGuiModuleManager
 {
@@ -34,8 +42,17 @@ public:
 	// Event called right after ImGui is updated, to give other subsystems chance to react.
 	FSimpleMulticastDelegate& OnPostImGuiUpdate() { return PostImGuiUpdateEvent; }
 
+	// Event called when memory is compacted, to give other subsystems chance to release their buffers.
+	FCompactMemoryDelegate& OnCompactMemory() { return CompactMemoryEvent; }
+
 	void RebuildFontAtlas();
 
+	// Make sure that module textures are loaded (requires Slate to be initialized).
+	void LoadTextures();
+
+	// Release transient buffers in all contexts and registered subsystems and log the reclaimed memory.
+	void CompactMemory();
+
 private:
 
 	FImGuiModuleManager();
@@ -47,7 +64,6 @@ private:
 	FImGuiModuleManager(FImGuiModuleManager&&) = delete;
 	FImGuiModuleManager& operator=(FImGuiModuleManager&&) = delete;
 
-	void LoadTextures();
 	void BuildFontAtlasTexture();
 
 	bool IsTickRegistered() { return TickDelegateHandle.IsValid(); }
@@ -61,6 +77,8 @@ private:
 
 	void OnViewportCreated();
 
+	void OnPostLoadMap(UWorld* World);
+
 	void AddWidgetToViewport(UGameViewportClient* GameViewport);
 	void AddWidgetsToActiveViewports();
 
@@ -69,6 +87,9 @@ private:
 	// Event that we call after ImGui is updated.
 	FSimpleMulticastDelegate PostImGuiUpdateEvent;
 
+	// Event that we call when memory is compacted.
+	FCompactMemoryDelegate CompactMemoryEvent;
+
 	// Collection of module state properties.
 	FImGuiModuleProperties Properties;
 
@@ -84,15 +105,28 @@ private:
 	// Manager for ImGui contexts.
 	FImGuiContextManager ContextManager;
 
+	// Widget that we add to all created contexts to draw ImGui stats.
+	FImGuiStatsPanel StatsPanel;
+
+	// Widget that we add to all created contexts to draw memory stats.
+	FImGuiMemoryPanel MemoryPanel;
+
+	// Widget that we add to all created contexts to find windows and console objects.
+	FImGuiCommandPalette CommandPalette;
+
 	// Manager for textures resources.
 	FTextureManager TextureManager;
 
+	// Batcher that submits lines recorded with FImGuiDebugDraw.
+	FImGuiDebugDrawBatcher DebugDrawBatcher;
+
 	// Slate widgets that we created.
 	TArray<TWeakPtr<SImGuiLayout>> Widgets;
 
 	FDelegateHandle TickInitializerHandle;
 	FDelegateHandle TickDelegateHandle;
 	FDelegateHandle ViewportCreatedHandle;
+	FDelegateHandle PostLoadMapHandle;
 
 	bool bTexturesLoaded = false;
 };
@@ -117,6 +117,9 @@ void FImGuiModuleSettings::UpdateSettings()
 		SetUseSoftwareCursor(SettingsObject->bUseSoftwareCursor);
 		SetToggleInputKey(SettingsObject->ToggleInput);
 		SetCanvasSizeInfo(SettingsObject->CanvasSize);
+		SetMemoryCompactTimers(SettingsObject->MemoryCompactTimer, SettingsObject->ContextMemoryCompactTimers);
+		bCompactMemoryOnMapLoad = SettingsObject->bCompactMemoryOnMapLoad;
+		bSharePIEContexts = SettingsObject->bSharePIEContexts;
 	}
 }
 
@@ -179,6 +182,7 @@ void FImGuiModuleSettings::SetToggleInputKey(const FImGuiKeyInfo& KeyInfo)
 	{
 		ToggleInputKey = KeyInfo;
 		Commands.SetKeyBinding(FImGuiModuleCommands::ToggleInput, ToggleInputKey);
+		OnToggleInputKeyChanged.Broadcast(ToggleInputKey);
 	}
 }
 
@@ -197,6 +201,16 @@ void FImGuiModuleSettings::SetDPIScaleInfo(const FImGuiDPIScaleInfo& ScaleInfo)
 	OnDPIScaleChangedDelegate.Broadcast(DPIScale);
 }
 
+void FImGuiModuleSettings::SetMemoryCompactTimers(float DefaultTimer, const TMap<FString, float>& ContextTimers)
+{
+	if (MemoryCompactTimer != DefaultTimer || !ContextMemoryCompactTimers.OrderIndependentCompareEqual(ContextTimers))
+	{
+		MemoryCompactTimer = DefaultTimer;
+		ContextMemoryCompactTimers = ContextTimers;
+		OnMemoryCompactTimerChanged.Broadcast();
+	}
+}
+
 #if WITH_EDITOR
 
 void FImGuiModuleSettings::OnPropertyChanged(class UObject* ObjectBeingModified, struct FPropertyChangedEvent& PropertyChangedEvent)
@@ -218,6 +218,27 @@ protected:
 	UPROPERTY(EditAnywhere, config, Category = "DPI Scale", Meta = (ShowOnlyInnerProperties))
 	FImGuiDPIScaleInfo DPIScale;
 
+	// Time in seconds after which ImGui releases transient buffers of windows and tables that are no longer used.
+	// Negative value disables compaction.
+	UPROPERTY(EditAnywhere, config, Category = "Memory")
+	float MemoryCompactTimer = 60.f;
+
+	// Compaction timers overriding the default one for selected contexts. Keys are context names, like 'Editor', 'Game'
+	// or 'PIEContext1'.
+	UPROPERTY(EditAnywhere, config, Category = "Memory", AdvancedDisplay)
+	TMap<FString, float> ContextMemoryCompactTimers;
+
+	// If true, memory of all ImGui contexts will be compacted after a map is loaded, like when using
+	// 'ImGui.CompactMemory' command.
+	UPROPERTY(EditAnywhere, config, Category = "Memory")
+	bool bCompactMemoryOnMapLoad = false;
+
+	// If true, all PIE instances running in this editor (like in multi-client PIE) share one ImGui context. Windows
+	// created by world delegates are only drawn in viewports of their worlds, while windows created by multi-context
+	// delegates are drawn in all of them but updated only once per frame. Takes effect in new PIE sessions.
+	UPROPERTY(EditAnywhere, config, Category = "Contexts")
+	bool bSharePIEContexts = false;
+
 	static UImGuiSettings* DefaultInstance;
 
 	friend class FImGuiModuleSettings;
@@ -237,6 +258,7 @@ public:
 	// Generic delegate used to notify changes of boolean properties.
 	DECLARE_MULTICAST_DELEGATE_OneParam(FBoolChangeDelegate, bool);
 	DECLARE_MULTICAST_DELEGATE_OneParam(FStringClassReferenceChangeDelegate, const FSoftClassPath&);
+	DECLARE_MULTICAST_DELEGATE_OneParam(FImGuiKeyInfoChangeDelegate, const FImGuiKeyInfo&);
 	DECLARE_MULTICAST_DELEGATE_OneParam(FImGuiCanvasSizeInfoChangeDelegate, const FImGuiCanvasSizeInfo&);
 	DECLARE_MULTICAST_DELEGATE_OneParam(FImGuiDPIScaleInfoChangeDelegate, const FImGuiDPIScaleInfo&);
 
@@ -267,18 +289,37 @@ public:
 	// Get the DPI Scale information.
 	const FImGuiDPIScaleInfo& GetDPIScaleInfo() const { return DPIScale; }
 
+	// Get the memory compaction timer for a context with the given name.
+	float GetMemoryCompactTimer(const FString& ContextName) const
+	{
+		const float* ContextTimer = ContextMemoryCompactTimers.Find(ContextName);
+		return ContextTimer ? *ContextTimer : MemoryCompactTimer;
+	}
+
+	// Whether memory should be compacted after loading a map.
+	bool ShouldCompactMemoryOnMapLoad() const { return bCompactMemoryOnMapLoad; }
+
+	// Whether PIE instances should share one context.
+	bool ShouldSharePIEContexts() const { return bSharePIEContexts; }
+
 	// Delegate raised when ImGui Input Handle is changed.
 	FStringClassReferenceChangeDelegate OnImGuiInputHandlerClassChanged;
 
 	// Delegate raised when software cursor configuration is changed.
 	FBoolChangeDelegate OnUseSoftwareCursorChanged;
 
+	// Delegate raised when the shortcut for 'ImGui.ToggleInput' command is changed.
+	FImGuiKeyInfoChangeDelegate OnToggleInputKeyChanged;
+
 	// Delegate raised when information how to calculate the canvas size is changed.
 	FImGuiCanvasSizeInfoChangeDelegate OnCanvasSizeChangedDelegate;
 
 	// Delegate raised when the DPI scale is changed.
 	FImGuiDPIScaleInfoChangeDelegate OnDPIScaleChangedDelegate;
 
+	// Delegate raised when any of the memory compaction timers is changed.
+	FSimpleMulticastDelegate OnMemoryCompactTimerChanged;
+
 private:
 
 	void InitializeAllSettings();
@@ -293,6 +334,7 @@ private:
 	void SetToggleInputKey(const FImGuiKeyInfo& KeyInfo);
 	void SetCanvasSizeInfo(const FImGuiCanvasSizeInfo& CanvasSizeInfo);
 	void SetDPIScaleInfo(const FImGuiDPIScaleInfo& ScaleInfo);
+	void SetMemoryCompactTimers(float DefaultTimer, const TMap<FString, float>& ContextTimers);
 
 #if WITH_EDITOR
 	void OnPropertyChanged(class UObject* ObjectBeingModified, struct FPropertyChangedEvent& PropertyChangedEvent);
@@ -305,8 +347,12 @@ private:
 	FImGuiKeyInfo ToggleInputKey;
 	FImGuiCanvasSizeInfo CanvasSize;
 	FImGuiDPIScaleInfo DPIScale;
+	TMap<FString, float> ContextMemoryCompactTimers;
+	float MemoryCompactTimer = 60.f;
 	bool bShareKeyboardInput = false;
 	bool bShareGamepadInput = false;
 	bool bShareMouseInput = false;
 	bool bUseSoftwareCursor = false;
+	bool bCompactMemoryOnMapLoad = false;
+	bool bSharePIEContexts = false;
 };
@@ -0,0 +1,362 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiParallelPanelsHost.h"
+
+#include "ImGuiAllocationTracker.h"
+#include "ImGuiDelegatesContainer.h"
+#include "ImGuiImplementation.h"
+#include "ImGuiInteroperability.h"
+
+#include <HAL/IConsoleManager.h>
+
+#include <imgui_internal.h>
+
+
+namespace CVars
+{
+	TAutoConsoleVariable<int> ParallelPanels(TEXT("ImGui.ParallelPanels"), 1,
+		TEXT("Whether parallel panels are built on worker threads.\n")
+		TEXT("0: build panels one after another on the game thread (can be useful for debugging)\n")
+		TEXT("1: build panels on worker threads (default)"),
+		ECVF_Default);
+}
+
+namespace
+{
+	constexpr ImGuiWindowFlags HostWindowFlags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoBackground
+		| ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoScrollWithMouse
+		| ImGuiWindowFlags_NoNav | ImGuiWindowFlags_NoFocusOnAppearing;
+
+	void BuildPanel(ImGuiContext* Context, const FImGuiParallelPanel& Panel)
+	{
+		ImGuiImplementation::SetThreadContext(Context);
+
+		ImGui::NewFrame();
+		Panel.Draw();
+		ImGui::Render();
+
+		ImGuiImplementation::SetThreadContext(nullptr);
+	}
+
+	// Remove keyboard events, except for modifiers and key releases, to keep unfocused panels in a consistent state.
+	void FilterKeyboardEvents(ImGuiContext& Context)
+	{
+		for (int32 Index = Context.InputEventsQueue.Size - 1; Index >= 0; Index--)
+		{
+			const ImGuiInputEvent& Event = Context.InputEventsQueue[Index];
+			const bool bRemove = (Event.Type == ImGuiInputEventType_Text)
+				|| (Event.Type == ImGuiInputEventType_Key && Event.Key.Down && (Event.Key.Key & ImGuiMod_Mask_) == 0);
+			if (bRemove)
+			{
+				Context.InputEventsQueue.erase(Context.InputEventsQueue.begin() + Index);
+			}
+		}
+	}
+
+	void CopyDrawList(ImDrawList& Dst, const ImDrawList& Src)
+	{
+		for (const ImDrawCmd& Command : Src.CmdBuffer)
+		{
+			// User callbacks are not supported by our renderer.
+			if (Command.UserCallback || Command.ElemCount == 0)
+			{
+				continue;
+			}
+
+			// Copy only vertices used by this command, so each command can be re-based in the destination list.
+			const ImDrawIdx* Indices = Src.IdxBuffer.Data + Command.IdxOffset;
+			uint32 MinIndex = MAX_uint32, MaxIndex = 0;
+			for (uint32 Index = 0; Index < Command.ElemCount; Index++)
+			{
+				MinIndex = FMath::Min<uint32>(MinIndex, Indices[Index]);
+				MaxIndex = FMath::Max<uint32>(MaxIndex, Indices[Index]);
+			}
+			const int32 NumVertices = MaxIndex - MinIndex + 1;
+
+			Dst.PushClipRect({ Command.ClipRect.x, Command.ClipRect.y }, { Command.ClipRect.z, Command.ClipRect.w }, false);
+			Dst.PushTextureID(Command.TextureId);
+
+			Dst.PrimReserve(Command.ElemCount, NumVertices);
+			FMemory::Memcpy(Dst._VtxWritePtr, Src.VtxBuffer.Data + Command.VtxOffset + MinIndex, NumVertices * sizeof(ImDrawVert));
+			for (uint32 Index = 0; Index < Command.ElemCount; Index++)
+			{
+				Dst._IdxWritePtr[Index] = (ImDrawIdx)(Dst._VtxCurrentIdx + Indices[Index] - MinIndex);
+			}
+			Dst._VtxWritePtr += NumVertices;
+			Dst._IdxWritePtr += Command.ElemCount;
+			Dst._VtxCurrentIdx += NumVertices;
+
+			Dst.PopTextureID();
+			Dst.PopClipRect();
+		}
+	}
+}
+
+class FImGuiParallelPanelsHost::FBuildPanelTask : public FNonAbandonableTask
+{
+public:
+
+	FBuildPanelTask(ImGuiContext* InContext)
+		: Context(InContext)
+	{
+	}
+
+	void DoWork()
+	{
+		BuildPanel(Context, *Info);
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FImGuiBuildPanelTask, STATGROUP_ThreadPoolAsyncTasks);
+	}
+
+	ImGuiContext* Context = nullptr;
+
+	// Set before every start, on the game thread.
+	TSharedPtr<const FImGuiParallelPanel> Info;
+};
+
+FImGuiParallelPanelsHost::FImGuiParallelPanelsHost(ImGuiContext& InHostContext)
+	: HostContext(InHostContext)
+{
+}
+
+FImGuiParallelPanelsHost::~FImGuiParallelPanelsHost()
+{
+	Wait();
+
+	for (auto& Pair : Panels)
+	{
+		DestroyPanel(Pair.Value);
+	}
+}
+
+void FImGuiParallelPanelsHost::BeginFrame(const FImGuiInputState& InputState)
+{
+	// Panels are joined when the host frame ends, so this should only matter if the frame ended without compositing.
+	Wait();
+
+	const auto& RegisteredPanels = FImGuiDelegatesContainer::Get().GetParallelPanels();
+
+	for (auto It = Panels.CreateIterator(); It; ++It)
+	{
+		FPanel& Panel = It.Value();
+
+		// Release contexts of removed panels.
+		if (!RegisteredPanels.Contains(It.Key()))
+		{
+			DestroyPanel(Panel);
+			It.RemoveCurrent();
+			continue;
+		}
+
+		// Skip panels that are not shown in this context (in this case, scratch contexts are between frames).
+		if (!Panel.bLaunched)
+		{
+			continue;
+		}
+		Panel.bLaunched = false;
+
+		ImGuiContext& Context = *Panel.Context;
+		ImGuiIO& IO = Context.IO;
+
+		// Follow the host context settings.
+		IO.DeltaTime = HostContext.IO.DeltaTime;
+		IO.DisplaySize = HostContext.IO.DisplaySize;
+		Context.Style = HostContext.Style;
+
+		ImGuiInterops::CopyInput(IO, InputState);
+
+		// Cursor is drawn by the host context.
+		IO.MouseDrawCursor = false;
+
+		// Mouse is only available when hovering over the panel or when the panel uses it (e.g. while dragging).
+		if (!Panel.bHovered && !Panel.bActive)
+		{
+			IO.MousePos = { -FLT_MAX, -FLT_MAX };
+			IO.MouseWheel = 0.f;
+		}
+
+		// Keyboard is only available when the panel is focused.
+		if (!Panel.bFocused)
+		{
+			FilterKeyboardEvents(Context);
+		}
+	}
+}
+
+void FImGuiParallelPanelsHost::Launch(TArrayView<const int32> Worlds)
+{
+	const auto& RegisteredPanels = FImGuiDelegatesContainer::Get().GetParallelPanels();
+	if (RegisteredPanels.Num() == 0)
+	{
+		return;
+	}
+
+	const bool bUseWorkers = CVars::ParallelPanels.GetValueOnGameThread() > 0;
+
+	// Panels are only added when they are shown in this context for the first time.
+	IMGUI_TRACK_CONTAINER_GROWTH(Panels);
+
+	for (const auto& Pair : RegisteredPanels)
+	{
+		const TSharedRef<const FImGuiParallelPanel>& Info = Pair.Value;
+		if (!Info->bAllWorlds && !Worlds.Contains(Info->WorldContextIndex))
+		{
+			continue;
+		}
+
+		FPanel& Panel = FindOrAddPanel(Pair.Key, *Info);
+		if (Panel.bLaunched)
+		{
+			continue;
+		}
+		Panel.bLaunched = true;
+
+		// Snapshots are taken on the game thread, before any of the panels starts.
+		if (Info->Snapshot)
+		{
+			Info->Snapshot();
+		}
+	}
+
+	for (const auto& Pair : RegisteredPanels)
+	{
+		FPanel* Panel = Panels.Find(Pair.Key);
+		if (Panel && Panel->bLaunched && !Panel->bTaskStarted)
+		{
+			Panel->Task->GetTask().Info = Pair.Value;
+
+			if (bUseWorkers)
+			{
+				Panel->Task->StartBackgroundTask();
+			}
+			else
+			{
+				Panel->Task->StartSynchronousTask();
+			}
+			Panel->bTaskStarted = true;
+		}
+	}
+}
+
+void FImGuiParallelPanelsHost::Composite()
+{
+	Wait();
+
+	for (auto& Pair : Panels)
+	{
+		if (Pair.Value.bLaunched)
+		{
+			CompositePanel(Pair.Value);
+		}
+	}
+}
+
+void FImGuiParallelPanelsHost::Wait()
+{
+	for (auto& Pair : Panels)
+	{
+		if (Pair.Value.bTaskStarted)
+		{
+			Pair.Value.Task->EnsureCompletion();
+			Pair.Value.bTaskStarted = false;
+		}
+	}
+}
+
+FImGuiParallelPanelsHost::FPanel& FImGuiParallelPanelsHost::FindOrAddPanel(int32 PanelId, const FImGuiParallelPanel& Info)
+{
+	FPanel* Panel = Panels.Find(PanelId);
+	if (!Panel)
+	{
+		Panel = &Panels.Add(PanelId);
+		Panel->HostWindowName = Info.WindowName + "##ParallelPanelHost";
+
+		// Creating a context would change the current context of this thread.
+		ImGuiContext* CurrentContext = ImGui::GetCurrentContext();
+		Panel->Context = ImGui::CreateContext(HostContext.IO.Fonts);
+		ImGui::SetCurrentContext(CurrentContext);
+
+		Panel->Task = MakeUnique<FAsyncTask<FBuildPanelTask>>(Panel->Context);
+
+		// Scratch frames are built on worker threads inside of the host frame, so the host keeps the shared font atlas
+		// locked and scratch contexts shouldn't touch the lock.
+		Panel->Context->FontAtlasLockedByHost = true;
+
+		ImGuiIO& IO = Panel->Context->IO;
+
+		// Panels are placed again on every session.
+		IO.IniFilename = nullptr;
+
+		IO.BackendFlags = HostContext.IO.BackendFlags;
+		IO.DisplaySize = HostContext.IO.DisplaySize;
+		Panel->Context->Style = HostContext.Style;
+		ImGuiInterops::SetUnrealKeyMap(IO);
+	}
+	return *Panel;
+}
+
+void FImGuiParallelPanelsHost::DestroyPanel(FPanel& Panel)
+{
+	if (Panel.Context)
+	{
+		if (Panel.bTaskStarted)
+		{
+			Panel.Task->EnsureCompletion();
+			Panel.bTaskStarted = false;
+		}
+		Panel.Task.Reset();
+
+		// Scratch contexts are never current, so destroying them doesn't change the current context.
+		ImGui::DestroyContext(Panel.Context);
+		Panel.Context = nullptr;
+	}
+}
+
+void FImGuiParallelPanelsHost::CompositePanel(FPanel& Panel)
+{
+	ImGuiContext& Context = *Panel.Context;
+
+	Panel.bActive = (Context.ActiveId != 0) || (Context.MovingWindow != nullptr);
+
+	// Host window covers all top-level windows of the panel, so it can block input for windows behind them.
+	ImRect Bounds{ FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX };
+	for (const ImGuiWindow* Window : Context.Windows)
+	{
+		const bool bIsTopLevel = !(Window->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_Tooltip));
+		if (Window->Active && !Window->Hidden && !Window->IsFallbackWindow && bIsTopLevel)
+		{
+			Bounds.Add(Window->Rect());
+		}
+	}
+
+	const ImDrawData& DrawData = Context.Viewports[0]->DrawDataP;
+	if (Bounds.Min.x > Bounds.Max.x || !DrawData.Valid)
+	{
+		Panel.bHovered = false;
+		Panel.bFocused = false;
+		return;
+	}
+
+	ImGui::SetNextWindowPos(Bounds.Min);
+	ImGui::SetNextWindowSize(Bounds.GetSize());
+	ImGui::Begin(Panel.HostWindowName.c_str(), nullptr, HostWindowFlags);
+
+	ImDrawList& DrawList = *ImGui::GetWindowDrawList();
+	for (int32 Index = 0; Index < DrawData.CmdListsCount; Index++)
+	{
+		CopyDrawList(DrawList, *DrawData.CmdLists[Index]);
+	}
+
+	Panel.bHovered = ImGui::IsWindowHovered();
+	Panel.bFocused = ImGui::IsWindowFocused();
+
+	if (Panel.bHovered)
+	{
+		ImGui::SetMouseCursor(Context.MouseCursor);
+	}
+
+	ImGui::End();
+}
@@ -0,0 +1,80 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <Async/AsyncWork.h>
+#include <Containers/ArrayView.h>
+#include <Containers/Map.h>
+
+#include <imgui.h>
+
+#include <string>
+
+
+class FImGuiInputState;
+struct FImGuiParallelPanel;
+
+// Builds parallel panels (see FImGuiDelegates::AddParallelPanel) shown in one context. Each panel has a persistent
+// scratch context, which is updated in three steps:
+// - BeginFrame: before the host frame, input is copied to scratch contexts, filtered by the panel host windows state,
+// - Launch: during debug events, snapshot functions are called and draw functions start on worker threads,
+// - Composite: before the host frame ends, workers are joined and their output is copied to host windows.
+class FImGuiParallelPanelsHost
+{
+public:
+
+	FImGuiParallelPanelsHost(ImGuiContext& InHostContext);
+	~FImGuiParallelPanelsHost();
+
+	FImGuiParallelPanelsHost(const FImGuiParallelPanelsHost&) = delete;
+	FImGuiParallelPanelsHost& operator=(const FImGuiParallelPanelsHost&) = delete;
+
+	FImGuiParallelPanelsHost(FImGuiParallelPanelsHost&&) = delete;
+	FImGuiParallelPanelsHost& operator=(FImGuiParallelPanelsHost&&) = delete;
+
+	// Copy input to scratch contexts. Should be called before the host context starts a new frame.
+	// @param InputState - Input state of the host context
+	void BeginFrame(const FImGuiInputState& InputState);
+
+	// Start building panels registered for any of the given worlds. Should be called on the game thread, during the
+	// host frame.
+	// @param Worlds - Indices of worlds using the host context
+	void Launch(TArrayView<const int32> Worlds);
+
+	// Wait for panels and copy their output to host windows. Host context must be current and in the middle of a frame.
+	void Composite();
+
+	// Wait until all panels are built, without compositing them.
+	void Wait();
+
+private:
+
+	class FBuildPanelTask;
+
+	struct FPanel
+	{
+		ImGuiContext* Context = nullptr;
+
+		// Created with the panel and restarted in every frame, so launching panels doesn't allocate.
+		TUniquePtr<FAsyncTask<FBuildPanelTask>> Task;
+		bool bTaskStarted = false;
+
+		std::string HostWindowName;
+
+		// State of the host window and scratch context from the last frame, used to route input.
+		bool bHovered = false;
+		bool bFocused = false;
+		bool bActive = false;
+
+		bool bLaunched = false;
+	};
+
+	FPanel& FindOrAddPanel(int32 PanelId, const FImGuiParallelPanel& Info);
+	void DestroyPanel(FPanel& Panel);
+
+	void CompositePanel(FPanel& Panel);
+
+	ImGuiContext& HostContext;
+
+	TMap<int32, FPanel> Panels;
+};
@@ -0,0 +1,96 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiSlatePainter.h"
+
+#include "ImGuiAllocationTracker.h"
+#include "ImGuiContextProxy.h"
+#include "ImGuiModuleDebug.h"
+#include "TextureManager.h"
+#include "VersionCompatibility.h"
+
+#include <Rendering/DrawElements.h>
+
+#if ENGINE_COMPATIBILITY_WITH_CPU_PROFILER_TRACE
+#include <ProfilingDebugging/CpuProfilerTrace.h>
+#endif
+
+
+void FImGuiSlatePainter::Paint(FImGuiContextProxy& ContextProxy, const FTextureManager& TextureManager, const FSlateRenderTransform& ImGuiToScreen,
+	const FSlateRect& MyClippingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, int32 WorldContextIndex)
+{
+	// Measured separately from the context update, so it only covers passing the output to Slate.
+	SCOPE_CYCLE_COUNTER(STAT_ImGuiWidgetPaint);
+	FImGuiFlightRecorder::FScope RecorderScope(ContextProxy.GetFlightRecorder(), EImGuiFramePhase::Paint);
+#if ENGINE_COMPATIBILITY_WITH_CPU_PROFILER_TRACE
+	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*ContextProxy.GetName());
+#endif
+
+	FImGuiPaintStatsScope PaintStats;
+
+	// Buffers are reused between paints, so they should only grow when the content does.
+	IMGUI_TRACK_CONTAINER_GROWTH(VertexCache);
+	IMGUI_TRACK_CONTAINER_GROWTH(IndexBuffer);
+
+	// Software cursor is drawn after all windows, from its own list.
+	const TArray<FImGuiDrawList>& DrawLists = ContextProxy.GetDrawData();
+	const FImGuiDrawList* CursorDrawList = ContextProxy.GetCursorDrawData();
+	const int32 NumDrawLists = DrawLists.Num() + (CursorDrawList ? 1 : 0);
+
+	for (int32 ListIndex = 0; ListIndex < NumDrawLists; ListIndex++)
+	{
+		const FImGuiDrawList& DrawList = (ListIndex < DrawLists.Num()) ? DrawLists[ListIndex] : *CursorDrawList;
+
+		// Skip windows of other viewports sharing this context.
+		if (!DrawList.IsVisibleInWorld(WorldContextIndex))
+		{
+			continue;
+		}
+
+		// Vertices are only converted when the list or the transform changes.
+#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+		const TArray<FSlateVertex>& VertexBuffer = VertexCache.GetVertices(ListIndex, DrawList, ImGuiToScreen, MyClippingRect);
+#else
+		const TArray<FSlateVertex>& VertexBuffer = VertexCache.GetVertices(ListIndex, DrawList, ImGuiToScreen);
+#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+
+		for (int CommandNb = 0; CommandNb < DrawList.NumCommands(); CommandNb++)
+		{
+			const auto& DrawCommand = DrawList.GetCommand(CommandNb, ImGuiToScreen);
+
+			DrawList.CopyIndexData(IndexBuffer, DrawCommand.IdxOffset, DrawCommand.NumElements, DrawCommand.VtxOffset);
+
+			// Get texture resource handle for this draw command (null index will be also mapped to a valid texture).
+			const FSlateResourceHandle& Handle = TextureManager.GetTextureHandle(DrawCommand.TextureId);
+
+			// Transform clipping rectangle to screen space and apply to elements that we draw.
+			const FSlateRect ClippingRect = DrawCommand.ClippingRect.IntersectionWith(MyClippingRect);
+
+#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+			// Get access to the Slate scissor rectangle defined in Slate Core API, so we can customize elements drawing.
+			extern SLATECORE_API TOptional<FShortRect> GSlateScissorRect;
+			TGuardValue<TOptional<FShortRect>> GSlateScissorRecGuard(GSlateScissorRect, FShortRect{ ClippingRect });
+#else
+			OutDrawElements.PushClip(FSlateClippingZone{ ClippingRect });
+#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+
+			// Add elements to the list.
+			FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId, Handle, VertexBuffer, IndexBuffer, nullptr, 0, 0);
+
+			// Every element gets its own copy of the whole vertex buffer.
+			PaintStats.AddElement(VertexBuffer.Num(), IndexBuffer.Num());
+
+#if !ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+			OutDrawElements.PopClip();
+#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+		}
+	}
+
+	VertexCache.Trim(NumDrawLists);
+}
+
+void FImGuiSlatePainter::CompactMemory(int64& InOutReclaimedBytes)
+{
+	InOutReclaimedBytes += VertexCache.GetAllocatedSize() + IndexBuffer.GetAllocatedSize();
+	VertexCache.Empty();
+	IndexBuffer.Empty();
+}
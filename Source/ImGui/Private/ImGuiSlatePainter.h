@@ -0,0 +1,40 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "ImGuiDrawData.h"
+
+#include <Rendering/RenderingCommon.h>
+
+
+class FImGuiContextProxy;
+class FSlateWindowElementList;
+class FTextureManager;
+
+// Paints draw data of an ImGui context as Slate elements. Converted vertices and index buffers are kept between paints,
+// so widgets that display contexts should own one painter each.
+class FImGuiSlatePainter
+{
+public:
+
+	// Add elements with the last draw data of a context to the draw element list.
+	// @param ContextProxy - Context whose draw data should be painted
+	// @param TextureManager - Texture manager used to resolve texture handles of draw commands
+	// @param ImGuiToScreen - Transform from ImGui to screen space
+	// @param MyClippingRect - Clipping rectangle of the widget
+	// @param OutDrawElements - Slate draw element list to which elements are added
+	// @param LayerId - Layer of added elements
+	// @param WorldContextIndex - Index of the world whose windows should be painted (windows that are not tagged with any
+	//     world are always painted)
+	void Paint(FImGuiContextProxy& ContextProxy, const FTextureManager& TextureManager, const FSlateRenderTransform& ImGuiToScreen,
+		const FSlateRect& MyClippingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, int32 WorldContextIndex);
+
+	// Release buffers, which are only used during painting, so this can be safely done between frames.
+	// @param InOutReclaimedBytes - Counter to which the size of released buffers is added
+	void CompactMemory(int64& InOutReclaimedBytes);
+
+private:
+
+	FImGuiVertexCache VertexCache;
+	TArray<SlateIndex> IndexBuffer;
+};
@@ -0,0 +1,123 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiSprites.h"
+
+#include <Math/VectorRegister.h>
+
+#include <imgui_internal.h>
+
+
+namespace
+{
+	// Maximum number of sprites that can be reserved at once without overflowing 16-bit indices.
+	constexpr int32 MaxSpritesPerChunk = (sizeof(ImDrawIdx) == 2 ? 0xFFFF : MAX_int32) / 4;
+
+	static_assert(offsetof(FImGuiSprite, Max) == offsetof(FImGuiSprite, Min) + sizeof(ImVec2),
+		"Sprite bounds need to be continuous to be loaded into one vector register.");
+
+	int32 GetSpritesThatFit(const ImDrawList& DrawList, int32 NumSprites)
+	{
+		NumSprites = FMath::Min(NumSprites, MaxSpritesPerChunk);
+
+		// With vertex offset, PrimReserve starts a new draw command when needed. Without it, we can only use what is
+		// left in the current one.
+		if (sizeof(ImDrawIdx) == 2 && !(DrawList.Flags & ImDrawListFlags_AllowVtxOffset))
+		{
+			NumSprites = FMath::Min(NumSprites, static_cast<int32>((1 << 16) - DrawList._VtxCurrentIdx) / 4);
+		}
+
+		return NumSprites;
+	}
+}
+
+void ImGui::AddSprites(ImDrawList* DrawList, ImTextureID TextureId, const FImGuiSprite* Sprites, int32 NumSprites, bool bClip)
+{
+	checkf(DrawList, TEXT("Null draw list."));
+	checkf(Sprites || NumSprites <= 0, TEXT("Null sprites array with NumSprites = %d."), NumSprites);
+
+	if (NumSprites <= 0)
+	{
+		return;
+	}
+
+	const bool bPushTextureId = TextureId != DrawList->_CmdHeader.TextureId;
+	if (bPushTextureId)
+	{
+		DrawList->PushTextureID(TextureId);
+	}
+
+	// Sprite is visible if (Min.x, Min.y, -Max.x, -Max.y) < (Clip.Max.x, Clip.Max.y, -Clip.Min.x, -Clip.Min.y), so we
+	// can test all four edges with one comparison.
+	const ImVec4& ClipRect = DrawList->_CmdHeader.ClipRect;
+	const VectorRegister ClipBounds = MakeVectorRegister(ClipRect.z, ClipRect.w, -ClipRect.x, -ClipRect.y);
+	const VectorRegister NegateMax = MakeVectorRegister(1.f, 1.f, -1.f, -1.f);
+
+	int32 SpriteIndex = 0;
+	while (SpriteIndex < NumSprites)
+	{
+		const int32 ChunkSize = GetSpritesThatFit(*DrawList, NumSprites - SpriteIndex);
+		if (ChunkSize <= 0)
+		{
+			break;
+		}
+
+		DrawList->PrimReserve(ChunkSize * 6, ChunkSize * 4);
+
+		// Read after reserve, which can reset the index when starting a new draw command.
+		ImDrawVert* VtxWritePtr = DrawList->_VtxWritePtr;
+		ImDrawIdx* IdxWritePtr = DrawList->_IdxWritePtr;
+		ImDrawIdx VtxIndex = static_cast<ImDrawIdx>(DrawList->_VtxCurrentIdx);
+
+		const FImGuiSprite* const ChunkEnd = Sprites + SpriteIndex + ChunkSize;
+		for (const FImGuiSprite* Sprite = Sprites + SpriteIndex; Sprite != ChunkEnd; ++Sprite)
+		{
+			if (bClip)
+			{
+				const VectorRegister Bounds = VectorMultiply(VectorLoad(&Sprite->Min.x), NegateMax);
+				if (VectorMaskBits(VectorCompareLT(Bounds, ClipBounds)) != 0xF)
+				{
+					continue;
+				}
+			}
+
+			IdxWritePtr[0] = VtxIndex; IdxWritePtr[1] = VtxIndex + 1; IdxWritePtr[2] = VtxIndex + 2;
+			IdxWritePtr[3] = VtxIndex; IdxWritePtr[4] = VtxIndex + 2; IdxWritePtr[5] = VtxIndex + 3;
+
+			VtxWritePtr[0].pos = Sprite->Min;
+			VtxWritePtr[0].uv = Sprite->UVMin;
+			VtxWritePtr[0].col = Sprite->Color;
+			VtxWritePtr[1].pos = ImVec2(Sprite->Max.x, Sprite->Min.y);
+			VtxWritePtr[1].uv = ImVec2(Sprite->UVMax.x, Sprite->UVMin.y);
+			VtxWritePtr[1].col = Sprite->Color;
+			VtxWritePtr[2].pos = Sprite->Max;
+			VtxWritePtr[2].uv = Sprite->UVMax;
+			VtxWritePtr[2].col = Sprite->Color;
+			VtxWritePtr[3].pos = ImVec2(Sprite->Min.x, Sprite->Max.y);
+			VtxWritePtr[3].uv = ImVec2(Sprite->UVMin.x, Sprite->UVMax.y);
+			VtxWritePtr[3].col = Sprite->Color;
+
+			VtxWritePtr += 4;
+			IdxWritePtr += 6;
+			VtxIndex += 4;
+		}
+
+		const int32 NumWritten = static_cast<int32>(VtxWritePtr - DrawList->_VtxWritePtr) / 4;
+
+		DrawList->_VtxWritePtr = VtxWritePtr;
+		DrawList->_IdxWritePtr = IdxWritePtr;
+		DrawList->_VtxCurrentIdx += NumWritten * 4;
+
+		// Give back space reserved for clipped sprites.
+		if (NumWritten < ChunkSize)
+		{
+			DrawList->PrimUnreserve((ChunkSize - NumWritten) * 6, (ChunkSize - NumWritten) * 4);
+		}
+
+		SpriteIndex += ChunkSize;
+	}
+
+	if (bPushTextureId)
+	{
+		DrawList->PopTextureID();
+	}
+}
@@ -0,0 +1,208 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiStatsPanel.h"
+
+#include "ImGuiAllocationTracker.h"
+#include "ImGuiContextManager.h"
+#include "ImGuiFileWriter.h"
+#include "ImGuiImplementation.h"
+#include "ImGuiModuleProperties.h"
+
+#include <imgui_internal.h>
+
+
+namespace
+{
+	enum EWindowColumn : ImGuiID
+	{
+		Name,
+		InclusiveTime,
+		ExclusiveTime,
+		Vertices,
+		Indices,
+		Commands
+	};
+
+	float GetColumnValue(const FImGuiWindowStats::FWindowEntry& Entry, ImGuiID Column)
+	{
+		switch (Column)
+		{
+		case EWindowColumn::InclusiveTime: return Entry.InclusiveTime;
+		case EWindowColumn::ExclusiveTime: return Entry.ExclusiveTime;
+		case EWindowColumn::Vertices: return Entry.Vertices;
+		case EWindowColumn::Indices: return Entry.Indices;
+		case EWindowColumn::Commands: return Entry.Commands;
+		default: return 0.f;
+		}
+	}
+}
+
+void FImGuiStatsPanel::DrawControls(int32 ContextIndex)
+{
+	if (Properties.ShowStats())
+	{
+		bool bOpen = true;
+		ImGui::SetNextWindowSize(ImVec2(620, 400), ImGuiCond_FirstUseEver);
+		if (ImGui::Begin("ImGui Stats", &bOpen))
+		{
+			ImGui::Text("ImGui Memory: %.1f KB", ImGuiImplementation::GetAllocatedBytes() / 1024.0);
+			ImGui::Text("Allocations in Last Frame: ImGui %d, Containers %d%s", ImGuiAllocationTracker::GetImGuiAllocations(),
+				ImGuiAllocationTracker::GetContainerAllocations(), ImGuiAllocationTracker::IsTripwireArmed() ? " (tripwire armed)" : "");
+
+			if (ImGui::BeginTabBar("Stats"))
+			{
+				if (ImGui::BeginTabItem("Windows"))
+				{
+					DrawWindowsTable(ContextIndex);
+					ImGui::EndTabItem();
+				}
+				if (ImGui::BeginTabItem("Quality"))
+				{
+					DrawQualityStats(ContextIndex);
+					ImGui::EndTabItem();
+				}
+				if (ImGui::BeginTabItem("Files"))
+				{
+					DrawFileStats();
+					ImGui::EndTabItem();
+				}
+				ImGui::EndTabBar();
+			}
+		}
+		ImGui::End();
+
+		if (!bOpen)
+		{
+			Properties.SetShowStats(false);
+		}
+	}
+}
+
+void FImGuiStatsPanel::DrawFileStats()
+{
+	const FImGuiFileWriter::FStats Stats = FImGuiFileWriter::Get().GetStats();
+
+	ImGui::Text("Written: %.1f KB", Stats.BytesWritten / 1024.0);
+	ImGui::Text("Pending: %.1f KB", Stats.PendingBytes / 1024.0);
+	ImGui::Text("Flush Latency: %.2f ms (max %.2f ms)", Stats.LastFlushLatency * 1000.0, Stats.MaxFlushLatency * 1000.0);
+	ImGui::Text("Stall Time: %.2f ms", Stats.StallTime * 1000.0);
+}
+
+void FImGuiStatsPanel::DrawQualityStats(int32 ContextIndex)
+{
+	const FImGuiContextProxy* ContextProxy = ContextManager.GetContextProxy(ContextIndex);
+	if (!ContextProxy)
+	{
+		return;
+	}
+
+	const FImGuiGeometryQuality& Quality = ContextProxy->GetGeometryQuality();
+
+	ImGui::Text("Density: %.2f points per unit", Quality.GetDensity());
+	ImGui::Text("Budget Level: %d / %d", Quality.GetBudgetLevel(), FImGuiGeometryQuality::MaxBudgetLevel);
+	ImGui::Text("Tessellation Error: %.2f points (base %.2f)", Quality.GetTessellationError(), Quality.GetBaseTessellationError());
+	ImGui::Text("Fringes: lines %s, fills %s", Quality.AreLineFringesDropped() ? "dropped" : "kept",
+		Quality.AreFillFringesDropped() ? "dropped" : "kept");
+
+	const float Reduction = Quality.GetEstimatedVertexReduction();
+	if (Reduction >= 0.f)
+	{
+		ImGui::Text("Estimated Vertex Reduction: %.0f%%", Reduction * 100.f);
+	}
+	else
+	{
+		ImGui::TextDisabled("Estimated Vertex Reduction: not enough samples");
+	}
+}
+
+void FImGuiStatsPanel::DrawWindowsTable(int32 ContextIndex)
+{
+	const FImGuiContextProxy* ContextProxy = ContextManager.GetContextProxy(ContextIndex);
+	if (!ContextProxy)
+	{
+		return;
+	}
+
+	const FImGuiWindowStats& Stats = ContextProxy->GetWindowStats();
+	const TArray<FImGuiWindowStats::FWindowEntry>& Entries = Stats.GetEntries();
+
+	ImGui::Text("Context: %ls, Windows: %d, Total: %.3f ms", *ContextProxy->GetName(), Entries.Num(), Stats.GetTotalTime());
+	ImGui::Text("Occluded Windows: %d, Vertices: %d", ContextProxy->GetNumOccludedWindows(), ContextProxy->GetNumOccludedVertices());
+
+	ImGui::SetNextItemWidth(120.f);
+	ImGui::SliderInt("Top N", &MaxWindows, 1, 100);
+	ImGui::SameLine();
+	ImGui::Checkbox("Show Inactive", &bShowInactiveWindows);
+
+	constexpr ImGuiTableFlags TableFlags = ImGuiTableFlags_Sortable | ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg
+		| ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY | ImGuiTableFlags_SizingFixedFit;
+
+	if (ImGui::BeginTable("Windows", 6, TableFlags))
+	{
+		ImGui::TableSetupScrollFreeze(0, 1);
+		ImGui::TableSetupColumn("Window", ImGuiTableColumnFlags_WidthStretch | ImGuiTableColumnFlags_NoSort, 0.f, EWindowColumn::Name);
+		ImGui::TableSetupColumn("Incl. ms", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_PreferSortDescending, 0.f, EWindowColumn::InclusiveTime);
+		ImGui::TableSetupColumn("Excl. ms", ImGuiTableColumnFlags_PreferSortDescending, 0.f, EWindowColumn::ExclusiveTime);
+		ImGui::TableSetupColumn("Vertices", ImGuiTableColumnFlags_PreferSortDescending, 0.f, EWindowColumn::Vertices);
+		ImGui::TableSetupColumn("Indices", ImGuiTableColumnFlags_PreferSortDescending, 0.f, EWindowColumn::Indices);
+		ImGui::TableSetupColumn("Commands", ImGuiTableColumnFlags_PreferSortDescending, 0.f, EWindowColumn::Commands);
+		ImGui::TableHeadersRow();
+
+		// Collect entries to show.
+		SortedEntries.Reset();
+		for (int32 Index = 0; Index < Entries.Num(); Index++)
+		{
+			if (bShowInactiveWindows || Entries[Index].Window->WasActive)
+			{
+				SortedEntries.Add(Index);
+			}
+		}
+
+		// Sort by the selected column. We sort every frame, because values are constantly changing.
+		ImGuiID SortColumn = EWindowColumn::InclusiveTime;
+		bool bAscending = false;
+		if (const ImGuiTableSortSpecs* SortSpecs = ImGui::TableGetSortSpecs())
+		{
+			if (SortSpecs->SpecsCount > 0)
+			{
+				SortColumn = SortSpecs->Specs[0].ColumnUserID;
+				bAscending = (SortSpecs->Specs[0].SortDirection == ImGuiSortDirection_Ascending);
+			}
+		}
+
+		SortedEntries.Sort([&](int32 A, int32 B)
+		{
+			const float ValueA = GetColumnValue(Entries[A], SortColumn);
+			const float ValueB = GetColumnValue(Entries[B], SortColumn);
+			return bAscending ? ValueA < ValueB : ValueA > ValueB;
+		});
+
+		const int32 NumRows = FMath::Min(SortedEntries.Num(), MaxWindows);
+		for (int32 Row = 0; Row < NumRows; Row++)
+		{
+			const FImGuiWindowStats::FWindowEntry& Entry = Entries[SortedEntries[Row]];
+
+			ImGui::TableNextRow();
+
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(Entry.Window->Name, ImGui::FindRenderedTextEnd(Entry.Window->Name));
+			if (ImGui::IsItemHovered())
+			{
+				ImGui::SetTooltip("%s", Entry.Window->Name);
+			}
+
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", Entry.InclusiveTime);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", Entry.ExclusiveTime);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.0f", Entry.Vertices);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.0f", Entry.Indices);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.1f", Entry.Commands);
+		}
+
+		ImGui::EndTable();
+	}
+}
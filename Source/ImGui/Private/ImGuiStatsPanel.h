@@ -0,0 +1,37 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+class FImGuiContextManager;
+class FImGuiModuleProperties;
+
+// Widget drawing module statistics, like the most expensive windows in the context.
+class FImGuiStatsPanel
+{
+public:
+
+	FImGuiStatsPanel(FImGuiModuleProperties& InProperties, FImGuiContextManager& InContextManager)
+		: Properties(InProperties)
+		, ContextManager(InContextManager)
+	{
+	}
+
+	void DrawControls(int32 ContextIndex);
+
+private:
+
+	void DrawWindowsTable(int32 ContextIndex);
+	void DrawFileStats();
+	void DrawQualityStats(int32 ContextIndex);
+
+	FImGuiModuleProperties& Properties;
+	FImGuiContextManager& ContextManager;
+
+	// Buffer reused to sort window entries.
+	TArray<int32> SortedEntries;
+
+	int32 MaxWindows = 20;
+	bool bShowInactiveWindows = false;
+};
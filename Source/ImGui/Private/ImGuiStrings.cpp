@@ -0,0 +1,185 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiStrings.h"
+
+#include <Containers/StringConv.h>
+#include <Hash/CityHash.h>
+#include <Templates/UniquePtr.h>
+
+
+namespace
+{
+	// Storage for null-terminated strings, allocated in blocks that are never moved so returned pointers stay valid
+	// until reset. Reset keeps memory for reuse.
+	template<typename CharType>
+	class TStringArena
+	{
+	public:
+
+		const CharType* Add(const CharType* Str, int32 Length)
+		{
+			const int32 Size = Length + 1;
+
+			if (!Blocks.IsValidIndex(CurrentBlock) || Blocks[CurrentBlock].Used + Size > Blocks[CurrentBlock].Capacity)
+			{
+				NextBlock(Size);
+			}
+
+			FBlock& Block = Blocks[CurrentBlock];
+			CharType* Dest = Block.Data.Get() + Block.Used;
+			FMemory::Memcpy(Dest, Str, Length * sizeof(CharType));
+			Dest[Length] = CharType(0);
+			Block.Used += Size;
+
+			return Dest;
+		}
+
+		void Reset()
+		{
+			for (FBlock& Block : Blocks)
+			{
+				Block.Used = 0;
+			}
+			CurrentBlock = 0;
+		}
+
+	private:
+
+		static constexpr int32 BlockSize = 16 * 1024;
+
+		struct FBlock
+		{
+			TUniquePtr<CharType[]> Data;
+			int32 Capacity = 0;
+			int32 Used = 0;
+		};
+
+		void NextBlock(int32 Size)
+		{
+			// Try to reuse blocks left after reset.
+			for (CurrentBlock++; CurrentBlock < Blocks.Num(); CurrentBlock++)
+			{
+				if (Blocks[CurrentBlock].Capacity >= Size)
+				{
+					return;
+				}
+			}
+
+			FBlock& Block = Blocks.AddDefaulted_GetRef();
+			Block.Capacity = FMath::Max(BlockSize, Size);
+			Block.Data = MakeUnique<CharType[]>(Block.Capacity);
+			CurrentBlock = Blocks.Num() - 1;
+		}
+
+		TArray<FBlock> Blocks;
+		int32 CurrentBlock = 0;
+	};
+
+	// FName comparison ignores case, but names that differ only in case should be displayed with their own casing.
+	struct FCaseSensitiveNameKeyFuncs : TDefaultMapKeyFuncs<FName, const char*, false>
+	{
+		static FORCEINLINE bool Matches(const FName& A, const FName& B)
+		{
+			return A.IsEqual(B, ENameCase::CaseSensitive);
+		}
+	};
+
+	struct FNameCache
+	{
+		TMap<FName, const char*, FDefaultSetAllocator, FCaseSensitiveNameKeyFuncs> Strings;
+		TStringArena<char> Arena;
+	};
+
+	struct FFrameCache
+	{
+		struct FEntry
+		{
+			const TCHAR* Source;
+			int32 Length;
+			const char* Converted;
+		};
+
+		// Keyed by the hash of the source string, which is verified on hit.
+		TMap<uint64, FEntry> Strings;
+		TStringArena<char> Arena;
+		TStringArena<TCHAR> SourceArena;
+		uint32 FrameNumber = 0;
+	};
+
+	FNameCache& GetNameCache()
+	{
+		static FNameCache Cache;
+		return Cache;
+	}
+
+	FFrameCache& GetFrameCache()
+	{
+		static FFrameCache Cache;
+		if (Cache.FrameNumber != GFrameNumber)
+		{
+			Cache.FrameNumber = GFrameNumber;
+			Cache.Strings.Reset();
+			Cache.Arena.Reset();
+			Cache.SourceArena.Reset();
+		}
+		return Cache;
+	}
+
+	const char* ConvertString(const TCHAR* Str, int32 Length)
+	{
+		checkf(IsInGameThread(), TEXT("ImGui strings can be only converted in the game thread."));
+
+		if (Length == 0)
+		{
+			return "";
+		}
+
+		FFrameCache& Cache = GetFrameCache();
+
+		const uint64 Hash = CityHash64(reinterpret_cast<const char*>(Str), Length * sizeof(TCHAR));
+		const FFrameCache::FEntry* Found = Cache.Strings.Find(Hash);
+		if (Found && Found->Length == Length && FMemory::Memcmp(Found->Source, Str, Length * sizeof(TCHAR)) == 0)
+		{
+			return Found->Converted;
+		}
+
+		const FTCHARToUTF8 Converted(Str, Length);
+		const char* Result = Cache.Arena.Add(reinterpret_cast<const char*>(Converted.Get()), Converted.Length());
+
+		// In case of a hash collision, the first string keeps the cache entry.
+		if (!Found)
+		{
+			Cache.Strings.Add(Hash, { Cache.SourceArena.Add(Str, Length), Length, Result });
+		}
+		return Result;
+	}
+}
+
+const char* FImGuiStrings::ToUTF8(FName Name)
+{
+	checkf(IsInGameThread(), TEXT("ImGui strings can be only converted in the game thread."));
+
+	FNameCache& Cache = GetNameCache();
+
+	if (const char** Found = Cache.Strings.Find(Name))
+	{
+		return *Found;
+	}
+
+	// Temporary string is allocated only once for every name.
+	const FString NameString = Name.ToString();
+	const FTCHARToUTF8 Converted(*NameString, NameString.Len());
+	const char* Result = Cache.Arena.Add(reinterpret_cast<const char*>(Converted.Get()), Converted.Length());
+	Cache.Strings.Add(Name, Result);
+	return Result;
+}
+
+const char* FImGuiStrings::ToUTF8(const TCHAR* Str)
+{
+	return Str ? ConvertString(Str, FCString::Strlen(Str)) : "";
+}
+
+const char* FImGuiStrings::ToUTF8(const FString& Str)
+{
+	return ConvertString(*Str, Str.Len());
+}
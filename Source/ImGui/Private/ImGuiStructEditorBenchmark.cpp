@@ -0,0 +1,349 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiStructEditorBenchmark.h"
+
+#include "ImGuiStructEditor.h"
+#include "VersionCompatibility.h"
+
+#include <HAL/IConsoleManager.h>
+#include <HAL/PlatformTime.h>
+#include <UObject/Class.h>
+#include <UObject/UnrealType.h>
+
+#include <imgui.h>
+
+
+IMGUI_STRUCT_BEGIN(FImGuiStructEditorBenchmarkData)
+	IMGUI_STRUCT_FIELD(Float000)
+	IMGUI_STRUCT_FIELD(Float001)
+	IMGUI_STRUCT_FIELD(Float002)
+	IMGUI_STRUCT_FIELD(Float003)
+	IMGUI_STRUCT_FIELD(Float004)
+	IMGUI_STRUCT_FIELD(Float005)
+	IMGUI_STRUCT_FIELD(Float006)
+	IMGUI_STRUCT_FIELD(Float007)
+	IMGUI_STRUCT_FIELD(Float008)
+	IMGUI_STRUCT_FIELD(Float009)
+	IMGUI_STRUCT_FIELD(Float010)
+	IMGUI_STRUCT_FIELD(Float011)
+	IMGUI_STRUCT_FIELD(Float012)
+	IMGUI_STRUCT_FIELD(Float013)
+	IMGUI_STRUCT_FIELD(Float014)
+	IMGUI_STRUCT_FIELD(Float015)
+	IMGUI_STRUCT_FIELD(Float016)
+	IMGUI_STRUCT_FIELD(Float017)
+	IMGUI_STRUCT_FIELD(Float018)
+	IMGUI_STRUCT_FIELD(Float019)
+	IMGUI_STRUCT_FIELD(Float020)
+	IMGUI_STRUCT_FIELD(Float021)
+	IMGUI_STRUCT_FIELD(Float022)
+	IMGUI_STRUCT_FIELD(Float023)
+	IMGUI_STRUCT_FIELD(Float024)
+	IMGUI_STRUCT_FIELD(Float025)
+	IMGUI_STRUCT_FIELD(Float026)
+	IMGUI_STRUCT_FIELD(Float027)
+	IMGUI_STRUCT_FIELD(Float028)
+	IMGUI_STRUCT_FIELD(Float029)
+	IMGUI_STRUCT_FIELD(Float030)
+	IMGUI_STRUCT_FIELD(Float031)
+	IMGUI_STRUCT_FIELD(Float032)
+	IMGUI_STRUCT_FIELD(Float033)
+	IMGUI_STRUCT_FIELD(Float034)
+	IMGUI_STRUCT_FIELD(Float035)
+	IMGUI_STRUCT_FIELD(Float036)
+	IMGUI_STRUCT_FIELD(Float037)
+	IMGUI_STRUCT_FIELD(Float038)
+	IMGUI_STRUCT_FIELD(Float039)
+	IMGUI_STRUCT_FIELD(Float040)
+	IMGUI_STRUCT_FIELD(Float041)
+	IMGUI_STRUCT_FIELD(Float042)
+	IMGUI_STRUCT_FIELD(Float043)
+	IMGUI_STRUCT_FIELD(Float044)
+	IMGUI_STRUCT_FIELD(Float045)
+	IMGUI_STRUCT_FIELD(Float046)
+	IMGUI_STRUCT_FIELD(Float047)
+	IMGUI_STRUCT_FIELD(Float048)
+	IMGUI_STRUCT_FIELD(Float049)
+	IMGUI_STRUCT_FIELD(Float050)
+	IMGUI_STRUCT_FIELD(Float051)
+	IMGUI_STRUCT_FIELD(Float052)
+	IMGUI_STRUCT_FIELD(Float053)
+	IMGUI_STRUCT_FIELD(Float054)
+	IMGUI_STRUCT_FIELD(Float055)
+	IMGUI_STRUCT_FIELD(Float056)
+	IMGUI_STRUCT_FIELD(Float057)
+	IMGUI_STRUCT_FIELD(Float058)
+	IMGUI_STRUCT_FIELD(Float059)
+	IMGUI_STRUCT_FIELD(Int000)
+	IMGUI_STRUCT_FIELD(Int001)
+	IMGUI_STRUCT_FIELD(Int002)
+	IMGUI_STRUCT_FIELD(Int003)
+	IMGUI_STRUCT_FIELD(Int004)
+	IMGUI_STRUCT_FIELD(Int005)
+	IMGUI_STRUCT_FIELD(Int006)
+	IMGUI_STRUCT_FIELD(Int007)
+	IMGUI_STRUCT_FIELD(Int008)
+	IMGUI_STRUCT_FIELD(Int009)
+	IMGUI_STRUCT_FIELD(Int010)
+	IMGUI_STRUCT_FIELD(Int011)
+	IMGUI_STRUCT_FIELD(Int012)
+	IMGUI_STRUCT_FIELD(Int013)
+	IMGUI_STRUCT_FIELD(Int014)
+	IMGUI_STRUCT_FIELD(Int015)
+	IMGUI_STRUCT_FIELD(Int016)
+	IMGUI_STRUCT_FIELD(Int017)
+	IMGUI_STRUCT_FIELD(Int018)
+	IMGUI_STRUCT_FIELD(Int019)
+	IMGUI_STRUCT_FIELD(Int020)
+	IMGUI_STRUCT_FIELD(Int021)
+	IMGUI_STRUCT_FIELD(Int022)
+	IMGUI_STRUCT_FIELD(Int023)
+	IMGUI_STRUCT_FIELD(Int024)
+	IMGUI_STRUCT_FIELD(Int025)
+	IMGUI_STRUCT_FIELD(Int026)
+	IMGUI_STRUCT_FIELD(Int027)
+	IMGUI_STRUCT_FIELD(Int028)
+	IMGUI_STRUCT_FIELD(Int029)
+	IMGUI_STRUCT_FIELD(Int030)
+	IMGUI_STRUCT_FIELD(Int031)
+	IMGUI_STRUCT_FIELD(Int032)
+	IMGUI_STRUCT_FIELD(Int033)
+	IMGUI_STRUCT_FIELD(Int034)
+	IMGUI_STRUCT_FIELD(Int035)
+	IMGUI_STRUCT_FIELD(Int036)
+	IMGUI_STRUCT_FIELD(Int037)
+	IMGUI_STRUCT_FIELD(Int038)
+	IMGUI_STRUCT_FIELD(Int039)
+	IMGUI_STRUCT_FIELD(Int040)
+	IMGUI_STRUCT_FIELD(Int041)
+	IMGUI_STRUCT_FIELD(Int042)
+	IMGUI_STRUCT_FIELD(Int043)
+	IMGUI_STRUCT_FIELD(Int044)
+	IMGUI_STRUCT_FIELD(Int045)
+	IMGUI_STRUCT_FIELD(Int046)
+	IMGUI_STRUCT_FIELD(Int047)
+	IMGUI_STRUCT_FIELD(Int048)
+	IMGUI_STRUCT_FIELD(Int049)
+	IMGUI_STRUCT_FIELD(Int050)
+	IMGUI_STRUCT_FIELD(Int051)
+	IMGUI_STRUCT_FIELD(Int052)
+	IMGUI_STRUCT_FIELD(Int053)
+	IMGUI_STRUCT_FIELD(Int054)
+	IMGUI_STRUCT_FIELD(Int055)
+	IMGUI_STRUCT_FIELD(Int056)
+	IMGUI_STRUCT_FIELD(Int057)
+	IMGUI_STRUCT_FIELD(Int058)
+	IMGUI_STRUCT_FIELD(Int059)
+	IMGUI_STRUCT_FIELD(Bool000)
+	IMGUI_STRUCT_FIELD(Bool001)
+	IMGUI_STRUCT_FIELD(Bool002)
+	IMGUI_STRUCT_FIELD(Bool003)
+	IMGUI_STRUCT_FIELD(Bool004)
+	IMGUI_STRUCT_FIELD(Bool005)
+	IMGUI_STRUCT_FIELD(Bool006)
+	IMGUI_STRUCT_FIELD(Bool007)
+	IMGUI_STRUCT_FIELD(Bool008)
+	IMGUI_STRUCT_FIELD(Bool009)
+	IMGUI_STRUCT_FIELD(Bool010)
+	IMGUI_STRUCT_FIELD(Bool011)
+	IMGUI_STRUCT_FIELD(Bool012)
+	IMGUI_STRUCT_FIELD(Bool013)
+	IMGUI_STRUCT_FIELD(Bool014)
+	IMGUI_STRUCT_FIELD(Bool015)
+	IMGUI_STRUCT_FIELD(Bool016)
+	IMGUI_STRUCT_FIELD(Bool017)
+	IMGUI_STRUCT_FIELD(Bool018)
+	IMGUI_STRUCT_FIELD(Bool019)
+	IMGUI_STRUCT_FIELD(Bool020)
+	IMGUI_STRUCT_FIELD(Bool021)
+	IMGUI_STRUCT_FIELD(Bool022)
+	IMGUI_STRUCT_FIELD(Bool023)
+	IMGUI_STRUCT_FIELD(Bool024)
+	IMGUI_STRUCT_FIELD(Bool025)
+	IMGUI_STRUCT_FIELD(Bool026)
+	IMGUI_STRUCT_FIELD(Bool027)
+	IMGUI_STRUCT_FIELD(Bool028)
+	IMGUI_STRUCT_FIELD(Bool029)
+	IMGUI_STRUCT_FIELD(Bool030)
+	IMGUI_STRUCT_FIELD(Bool031)
+	IMGUI_STRUCT_FIELD(Bool032)
+	IMGUI_STRUCT_FIELD(Bool033)
+	IMGUI_STRUCT_FIELD(Bool034)
+	IMGUI_STRUCT_FIELD(Bool035)
+	IMGUI_STRUCT_FIELD(Bool036)
+	IMGUI_STRUCT_FIELD(Bool037)
+	IMGUI_STRUCT_FIELD(Bool038)
+	IMGUI_STRUCT_FIELD(Bool039)
+	IMGUI_STRUCT_FIELD(Vector000)
+	IMGUI_STRUCT_FIELD(Vector001)
+	IMGUI_STRUCT_FIELD(Vector002)
+	IMGUI_STRUCT_FIELD(Vector003)
+	IMGUI_STRUCT_FIELD(Vector004)
+	IMGUI_STRUCT_FIELD(Vector005)
+	IMGUI_STRUCT_FIELD(Vector006)
+	IMGUI_STRUCT_FIELD(Vector007)
+	IMGUI_STRUCT_FIELD(Vector008)
+	IMGUI_STRUCT_FIELD(Vector009)
+	IMGUI_STRUCT_FIELD(Vector010)
+	IMGUI_STRUCT_FIELD(Vector011)
+	IMGUI_STRUCT_FIELD(Vector012)
+	IMGUI_STRUCT_FIELD(Vector013)
+	IMGUI_STRUCT_FIELD(Vector014)
+	IMGUI_STRUCT_FIELD(Vector015)
+	IMGUI_STRUCT_FIELD(Vector016)
+	IMGUI_STRUCT_FIELD(Vector017)
+	IMGUI_STRUCT_FIELD(Vector018)
+	IMGUI_STRUCT_FIELD(Vector019)
+	IMGUI_STRUCT_FIELD(Rotator000)
+	IMGUI_STRUCT_FIELD(Rotator001)
+	IMGUI_STRUCT_FIELD(Rotator002)
+	IMGUI_STRUCT_FIELD(Rotator003)
+	IMGUI_STRUCT_FIELD(Rotator004)
+	IMGUI_STRUCT_FIELD(Rotator005)
+	IMGUI_STRUCT_FIELD(Rotator006)
+	IMGUI_STRUCT_FIELD(Rotator007)
+	IMGUI_STRUCT_FIELD(Rotator008)
+	IMGUI_STRUCT_FIELD(Rotator009)
+	IMGUI_STRUCT_FIELD(Color000)
+	IMGUI_STRUCT_FIELD(Color001)
+	IMGUI_STRUCT_FIELD(Color002)
+	IMGUI_STRUCT_FIELD(Color003)
+	IMGUI_STRUCT_FIELD(Color004)
+	IMGUI_STRUCT_FIELD(Color005)
+	IMGUI_STRUCT_FIELD(Color006)
+	IMGUI_STRUCT_FIELD(Color007)
+	IMGUI_STRUCT_FIELD(Color008)
+	IMGUI_STRUCT_FIELD(Color009)
+IMGUI_STRUCT_END()
+
+#if !ENGINE_COMPATIBILITY_LEGACY_UPROPERTY
+
+DEFINE_LOG_CATEGORY_STATIC(LogImGuiStructEditor, Log, All);
+
+namespace
+{
+	// Editor that finds widgets for fields at runtime, from reflection data. It supports only field types of the
+	// benchmark struct and uses the same widgets as the compile-time editor, so only the dispatch cost differs.
+	bool EditProperties(const UScriptStruct& Struct, void* Data)
+	{
+		bool bChanged = false;
+		for (TFieldIterator<FProperty> It(&Struct); It; ++It)
+		{
+			const FProperty* Property = *It;
+			void* Value = Property->ContainerPtrToValuePtr<void>(Data);
+			const char* Label = FImGuiStrings::ToUTF8(Property->GetFName());
+
+			if (CastField<FFloatProperty>(Property))
+			{
+				bChanged |= ImGuiStructEditor::Edit(Label, *static_cast<float*>(Value));
+			}
+			else if (CastField<FIntProperty>(Property))
+			{
+				bChanged |= ImGuiStructEditor::Edit(Label, *static_cast<int32*>(Value));
+			}
+			else if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+			{
+				bool bValue = BoolProperty->GetPropertyValue(Value);
+				if (ImGuiStructEditor::Edit(Label, bValue))
+				{
+					BoolProperty->SetPropertyValue(Value, bValue);
+					bChanged = true;
+				}
+			}
+			else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+			{
+				if (StructProperty->Struct == TBaseStructure<FVector>::Get())
+				{
+					bChanged |= ImGuiStructEditor::Edit(Label, *static_cast<FVector*>(Value));
+				}
+				else if (StructProperty->Struct == TBaseStructure<FRotator>::Get())
+				{
+					bChanged |= ImGuiStructEditor::Edit(Label, *static_cast<FRotator*>(Value));
+				}
+				else if (StructProperty->Struct == TBaseStructure<FLinearColor>::Get())
+				{
+					bChanged |= ImGuiStructEditor::Edit(Label, *static_cast<FLinearColor*>(Value));
+				}
+			}
+		}
+		return bChanged;
+	}
+
+	// Draw the struct in a number of frames of a scratch context and return the average time of the editor calls.
+	template<typename TEditFunction>
+	double MeasureEditor(ImGuiContext* Context, int32 NumFrames, TEditFunction&& EditFunction)
+	{
+		ImGui::SetCurrentContext(Context);
+
+		uint64 Cycles = 0;
+		for (int32 Frame = 0; Frame < NumFrames; Frame++)
+		{
+			ImGui::NewFrame();
+
+			// Window covers all fields, so none of them is clipped.
+			ImGui::SetNextWindowPos({ 0.f, 0.f });
+			ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+			ImGui::Begin("Struct Editor Benchmark", nullptr, ImGuiWindowFlags_NoSavedSettings);
+
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			EditFunction();
+			Cycles += FPlatformTime::Cycles64() - StartCycles;
+
+			ImGui::End();
+			ImGui::Render();
+		}
+
+		return FPlatformTime::ToSeconds64(Cycles) / NumFrames;
+	}
+
+	void RunBenchmark(const TArray<FString>& Args)
+	{
+		const int32 NumFrames = (Args.Num() > 0) ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 1000;
+
+		ImGuiContext* OldContext = ImGui::GetCurrentContext();
+
+		// Scratch context with its own font atlas, so the benchmark doesn't depend on contexts of the module.
+		ImGuiContext* Context = ImGui::CreateContext();
+		ImGui::SetCurrentContext(Context);
+
+		ImGuiIO& IO = ImGui::GetIO();
+		IO.IniFilename = nullptr;
+		IO.DeltaTime = 1.f / 60.f;
+		IO.DisplaySize = { 1024.f, 8192.f };
+
+		unsigned char* Pixels;
+		int Width, Height;
+		IO.Fonts->GetTexDataAsAlpha8(&Pixels, &Width, &Height);
+
+		FImGuiStructEditorBenchmarkData Data;
+		UScriptStruct& Struct = *FImGuiStructEditorBenchmarkData::StaticStruct();
+
+		int32 NumFields = 0;
+		for (TFieldIterator<FProperty> It(&Struct); It; ++It)
+		{
+			NumFields++;
+		}
+
+		// Warm up both editors, so window and item state is created before measuring.
+		MeasureEditor(Context, 2, [&]() { ImGui::EditStructFields(Data); });
+		MeasureEditor(Context, 2, [&]() { EditProperties(Struct, &Data); });
+
+		const double CompileTimeEditorTime = MeasureEditor(Context, NumFrames, [&]() { ImGui::EditStructFields(Data); });
+		const double PropertyEditorTime = MeasureEditor(Context, NumFrames, [&]() { EditProperties(Struct, &Data); });
+
+		ImGui::DestroyContext(Context);
+		ImGui::SetCurrentContext(OldContext);
+
+		UE_LOG(LogImGuiStructEditor, Display, TEXT("Struct editor benchmark: %d fields, %d frames, compile-time editor %.3f us, FProperty editor %.3f us per frame (%.2fx)."),
+			NumFields, NumFrames, CompileTimeEditorTime * 1000000.0, PropertyEditorTime * 1000000.0,
+			PropertyEditorTime / FMath::Max(CompileTimeEditorTime, 1e-9));
+	}
+
+	FAutoConsoleCommand BenchmarkCommand(TEXT("ImGui.StructEditor.Benchmark"),
+		TEXT("Measure CPU cost of editing a struct with 200 fields with the compile-time editor from ImGuiStructEditor.h\n")
+		TEXT("and with an editor driven by FProperty reflection data, in a scratch context.\n")
+		TEXT("Usage: ImGui.StructEditor.Benchmark [Frames=1000]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunBenchmark));
+}
+
+#endif // !ENGINE_COMPATIBILITY_LEGACY_UPROPERTY
@@ -0,0 +1,617 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <UObject/ObjectMacros.h>
+
+#include "ImGuiStructEditorBenchmark.generated.h"
+
+
+// Struct with 200 fields edited by the ImGui.StructEditor.Benchmark command, both with the compile-time editor from
+// ImGuiStructEditor.h and with an editor driven by reflection data. Fields are listed in ImGuiStructEditorBenchmark.cpp.
+USTRUCT()
+struct FImGuiStructEditorBenchmarkData
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	float Float000 = 0.f;
+
+	UPROPERTY()
+	float Float001 = 0.f;
+
+	UPROPERTY()
+	float Float002 = 0.f;
+
+	UPROPERTY()
+	float Float003 = 0.f;
+
+	UPROPERTY()
+	float Float004 = 0.f;
+
+	UPROPERTY()
+	float Float005 = 0.f;
+
+	UPROPERTY()
+	float Float006 = 0.f;
+
+	UPROPERTY()
+	float Float007 = 0.f;
+
+	UPROPERTY()
+	float Float008 = 0.f;
+
+	UPROPERTY()
+	float Float009 = 0.f;
+
+	UPROPERTY()
+	float Float010 = 0.f;
+
+	UPROPERTY()
+	float Float011 = 0.f;
+
+	UPROPERTY()
+	float Float012 = 0.f;
+
+	UPROPERTY()
+	float Float013 = 0.f;
+
+	UPROPERTY()
+	float Float014 = 0.f;
+
+	UPROPERTY()
+	float Float015 = 0.f;
+
+	UPROPERTY()
+	float Float016 = 0.f;
+
+	UPROPERTY()
+	float Float017 = 0.f;
+
+	UPROPERTY()
+	float Float018 = 0.f;
+
+	UPROPERTY()
+	float Float019 = 0.f;
+
+	UPROPERTY()
+	float Float020 = 0.f;
+
+	UPROPERTY()
+	float Float021 = 0.f;
+
+	UPROPERTY()
+	float Float022 = 0.f;
+
+	UPROPERTY()
+	float Float023 = 0.f;
+
+	UPROPERTY()
+	float Float024 = 0.f;
+
+	UPROPERTY()
+	float Float025 = 0.f;
+
+	UPROPERTY()
+	float Float026 = 0.f;
+
+	UPROPERTY()
+	float Float027 = 0.f;
+
+	UPROPERTY()
+	float Float028 = 0.f;
+
+	UPROPERTY()
+	float Float029 = 0.f;
+
+	UPROPERTY()
+	float Float030 = 0.f;
+
+	UPROPERTY()
+	float Float031 = 0.f;
+
+	UPROPERTY()
+	float Float032 = 0.f;
+
+	UPROPERTY()
+	float Float033 = 0.f;
+
+	UPROPERTY()
+	float Float034 = 0.f;
+
+	UPROPERTY()
+	float Float035 = 0.f;
+
+	UPROPERTY()
+	float Float036 = 0.f;
+
+	UPROPERTY()
+	float Float037 = 0.f;
+
+	UPROPERTY()
+	float Float038 = 0.f;
+
+	UPROPERTY()
+	float Float039 = 0.f;
+
+	UPROPERTY()
+	float Float040 = 0.f;
+
+	UPROPERTY()
+	float Float041 = 0.f;
+
+	UPROPERTY()
+	float Float042 = 0.f;
+
+	UPROPERTY()
+	float Float043 = 0.f;
+
+	UPROPERTY()
+	float Float044 = 0.f;
+
+	UPROPERTY()
+	float Float045 = 0.f;
+
+	UPROPERTY()
+	float Float046 = 0.f;
+
+	UPROPERTY()
+	float Float047 = 0.f;
+
+	UPROPERTY()
+	float Float048 = 0.f;
+
+	UPROPERTY()
+	float Float049 = 0.f;
+
+	UPROPERTY()
+	float Float050 = 0.f;
+
+	UPROPERTY()
+	float Float051 = 0.f;
+
+	UPROPERTY()
+	float Float052 = 0.f;
+
+	UPROPERTY()
+	float Float053 = 0.f;
+
+	UPROPERTY()
+	float Float054 = 0.f;
+
+	UPROPERTY()
+	float Float055 = 0.f;
+
+	UPROPERTY()
+	float Float056 = 0.f;
+
+	UPROPERTY()
+	float Float057 = 0.f;
+
+	UPROPERTY()
+	float Float058 = 0.f;
+
+	UPROPERTY()
+	float Float059 = 0.f;
+
+	UPROPERTY()
+	int32 Int000 = 0;
+
+	UPROPERTY()
+	int32 Int001 = 0;
+
+	UPROPERTY()
+	int32 Int002 = 0;
+
+	UPROPERTY()
+	int32 Int003 = 0;
+
+	UPROPERTY()
+	int32 Int004 = 0;
+
+	UPROPERTY()
+	int32 Int005 = 0;
+
+	UPROPERTY()
+	int32 Int006 = 0;
+
+	UPROPERTY()
+	int32 Int007 = 0;
+
+	UPROPERTY()
+	int32 Int008 = 0;
+
+	UPROPERTY()
+	int32 Int009 = 0;
+
+	UPROPERTY()
+	int32 Int010 = 0;
+
+	UPROPERTY()
+	int32 Int011 = 0;
+
+	UPROPERTY()
+	int32 Int012 = 0;
+
+	UPROPERTY()
+	int32 Int013 = 0;
+
+	UPROPERTY()
+	int32 Int014 = 0;
+
+	UPROPERTY()
+	int32 Int015 = 0;
+
+	UPROPERTY()
+	int32 Int016 = 0;
+
+	UPROPERTY()
+	int32 Int017 = 0;
+
+	UPROPERTY()
+	int32 Int018 = 0;
+
+	UPROPERTY()
+	int32 Int019 = 0;
+
+	UPROPERTY()
+	int32 Int020 = 0;
+
+	UPROPERTY()
+	int32 Int021 = 0;
+
+	UPROPERTY()
+	int32 Int022 = 0;
+
+	UPROPERTY()
+	int32 Int023 = 0;
+
+	UPROPERTY()
+	int32 Int024 = 0;
+
+	UPROPERTY()
+	int32 Int025 = 0;
+
+	UPROPERTY()
+	int32 Int026 = 0;
+
+	UPROPERTY()
+	int32 Int027 = 0;
+
+	UPROPERTY()
+	int32 Int028 = 0;
+
+	UPROPERTY()
+	int32 Int029 = 0;
+
+	UPROPERTY()
+	int32 Int030 = 0;
+
+	UPROPERTY()
+	int32 Int031 = 0;
+
+	UPROPERTY()
+	int32 Int032 = 0;
+
+	UPROPERTY()
+	int32 Int033 = 0;
+
+	UPROPERTY()
+	int32 Int034 = 0;
+
+	UPROPERTY()
+	int32 Int035 = 0;
+
+	UPROPERTY()
+	int32 Int036 = 0;
+
+	UPROPERTY()
+	int32 Int037 = 0;
+
+	UPROPERTY()
+	int32 Int038 = 0;
+
+	UPROPERTY()
+	int32 Int039 = 0;
+
+	UPROPERTY()
+	int32 Int040 = 0;
+
+	UPROPERTY()
+	int32 Int041 = 0;
+
+	UPROPERTY()
+	int32 Int042 = 0;
+
+	UPROPERTY()
+	int32 Int043 = 0;
+
+	UPROPERTY()
+	int32 Int044 = 0;
+
+	UPROPERTY()
+	int32 Int045 = 0;
+
+	UPROPERTY()
+	int32 Int046 = 0;
+
+	UPROPERTY()
+	int32 Int047 = 0;
+
+	UPROPERTY()
+	int32 Int048 = 0;
+
+	UPROPERTY()
+	int32 Int049 = 0;
+
+	UPROPERTY()
+	int32 Int050 = 0;
+
+	UPROPERTY()
+	int32 Int051 = 0;
+
+	UPROPERTY()
+	int32 Int052 = 0;
+
+	UPROPERTY()
+	int32 Int053 = 0;
+
+	UPROPERTY()
+	int32 Int054 = 0;
+
+	UPROPERTY()
+	int32 Int055 = 0;
+
+	UPROPERTY()
+	int32 Int056 = 0;
+
+	UPROPERTY()
+	int32 Int057 = 0;
+
+	UPROPERTY()
+	int32 Int058 = 0;
+
+	UPROPERTY()
+	int32 Int059 = 0;
+
+	UPROPERTY()
+	bool Bool000 = false;
+
+	UPROPERTY()
+	bool Bool001 = false;
+
+	UPROPERTY()
+	bool Bool002 = false;
+
+	UPROPERTY()
+	bool Bool003 = false;
+
+	UPROPERTY()
+	bool Bool004 = false;
+
+	UPROPERTY()
+	bool Bool005 = false;
+
+	UPROPERTY()
+	bool Bool006 = false;
+
+	UPROPERTY()
+	bool Bool007 = false;
+
+	UPROPERTY()
+	bool Bool008 = false;
+
+	UPROPERTY()
+	bool Bool009 = false;
+
+	UPROPERTY()
+	bool Bool010 = false;
+
+	UPROPERTY()
+	bool Bool011 = false;
+
+	UPROPERTY()
+	bool Bool012 = false;
+
+	UPROPERTY()
+	bool Bool013 = false;
+
+	UPROPERTY()
+	bool Bool014 = false;
+
+	UPROPERTY()
+	bool Bool015 = false;
+
+	UPROPERTY()
+	bool Bool016 = false;
+
+	UPROPERTY()
+	bool Bool017 = false;
+
+	UPROPERTY()
+	bool Bool018 = false;
+
+	UPROPERTY()
+	bool Bool019 = false;
+
+	UPROPERTY()
+	bool Bool020 = false;
+
+	UPROPERTY()
+	bool Bool021 = false;
+
+	UPROPERTY()
+	bool Bool022 = false;
+
+	UPROPERTY()
+	bool Bool023 = false;
+
+	UPROPERTY()
+	bool Bool024 = false;
+
+	UPROPERTY()
+	bool Bool025 = false;
+
+	UPROPERTY()
+	bool Bool026 = false;
+
+	UPROPERTY()
+	bool Bool027 = false;
+
+	UPROPERTY()
+	bool Bool028 = false;
+
+	UPROPERTY()
+	bool Bool029 = false;
+
+	UPROPERTY()
+	bool Bool030 = false;
+
+	UPROPERTY()
+	bool Bool031 = false;
+
+	UPROPERTY()
+	bool Bool032 = false;
+
+	UPROPERTY()
+	bool Bool033 = false;
+
+	UPROPERTY()
+	bool Bool034 = false;
+
+	UPROPERTY()
+	bool Bool035 = false;
+
+	UPROPERTY()
+	bool Bool036 = false;
+
+	UPROPERTY()
+	bool Bool037 = false;
+
+	UPROPERTY()
+	bool Bool038 = false;
+
+	UPROPERTY()
+	bool Bool039 = false;
+
+	UPROPERTY()
+	FVector Vector000 = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector Vector001 = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector Vector002 = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector Vector003 = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector Vector004 = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector Vector005 = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector Vector006 = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector Vector007 = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector Vector008 = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector Vector009 = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector Vector010 = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector Vector011 = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector Vector012 = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector Vector013 = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector Vector014 = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector Vector015 = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector Vector016 = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector Vector017 = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector Vector018 = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector Vector019 = FVector::ZeroVector;
+
+	UPROPERTY()
+	FRotator Rotator000 = FRotator::ZeroRotator;
+
+	UPROPERTY()
+	FRotator Rotator001 = FRotator::ZeroRotator;
+
+	UPROPERTY()
+	FRotator Rotator002 = FRotator::ZeroRotator;
+
+	UPROPERTY()
+	FRotator Rotator003 = FRotator::ZeroRotator;
+
+	UPROPERTY()
+	FRotator Rotator004 = FRotator::ZeroRotator;
+
+	UPROPERTY()
+	FRotator Rotator005 = FRotator::ZeroRotator;
+
+	UPROPERTY()
+	FRotator Rotator006 = FRotator::ZeroRotator;
+
+	UPROPERTY()
+	FRotator Rotator007 = FRotator::ZeroRotator;
+
+	UPROPERTY()
+	FRotator Rotator008 = FRotator::ZeroRotator;
+
+	UPROPERTY()
+	FRotator Rotator009 = FRotator::ZeroRotator;
+
+	UPROPERTY()
+	FLinearColor Color000 = FLinearColor::White;
+
+	UPROPERTY()
+	FLinearColor Color001 = FLinearColor::White;
+
+	UPROPERTY()
+	FLinearColor Color002 = FLinearColor::White;
+
+	UPROPERTY()
+	FLinearColor Color003 = FLinearColor::White;
+
+	UPROPERTY()
+	FLinearColor Color004 = FLinearColor::White;
+
+	UPROPERTY()
+	FLinearColor Color005 = FLinearColor::White;
+
+	UPROPERTY()
+	FLinearColor Color006 = FLinearColor::White;
+
+	UPROPERTY()
+	FLinearColor Color007 = FLinearColor::White;
+
+	UPROPERTY()
+	FLinearColor Color008 = FLinearColor::White;
+
+	UPROPERTY()
+	FLinearColor Color009 = FLinearColor::White;
+};
@@ -0,0 +1,50 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include <imgui_internal.h>
+
+
+// Opaque parts of windows collected while walking windows from front to back, to find windows fully covered by them.
+// In contexts shared by several worlds, windows are drawn only in viewports of their worlds, so they can only occlude
+// windows of the same world. Windows that are not tagged with any world (INDEX_NONE) are drawn in all viewports, so
+// they can occlude windows of all worlds, but can only be occluded by other windows drawn in all viewports.
+class FImGuiWindowOccluders
+{
+public:
+
+	// Remove all occluders.
+	void Reset() { Occluders.Reset(); }
+
+	// Add the opaque part of a window.
+	// @param OpaqueRect - Opaque part of the window
+	// @param World - Index of the window's world or INDEX_NONE if the window is drawn in all worlds
+	void Add(const ImRect& OpaqueRect, int32 World)
+	{
+		Occluders.Add({ OpaqueRect, World });
+	}
+
+	// Check whether a window is fully covered by any of the occluders visible in the same viewports.
+	// @param Rect - Bounds of the window
+	// @param World - Index of the window's world or INDEX_NONE if the window is drawn in all worlds
+	// @returns True, if the window is occluded
+	bool IsOccluded(const ImRect& Rect, int32 World) const
+	{
+		return Occluders.ContainsByPredicate([&Rect, World](const FOccluder& Occluder)
+		{
+			return (Occluder.World == INDEX_NONE || Occluder.World == World) && Occluder.Rect.Contains(Rect);
+		});
+	}
+
+private:
+
+	struct FOccluder
+	{
+		ImRect Rect;
+		int32 World;
+	};
+
+	TArray<FOccluder, TInlineAllocator<32>> Occluders;
+};
@@ -0,0 +1,185 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiWindowStats.h"
+
+#include "ImGuiDrawData.h"
+#include "VersionCompatibility.h"
+
+#include <HAL/IConsoleManager.h>
+#include <HAL/PlatformTime.h>
+
+#if ENGINE_COMPATIBILITY_WITH_CPU_PROFILER_TRACE
+#include <ProfilingDebugging/CpuProfilerTrace.h>
+#endif
+
+#include <imgui_internal.h>
+
+
+#if ENGINE_COMPATIBILITY_WITH_CPU_PROFILER_TRACE && CPUPROFILERTRACE_ENABLED
+#define IMGUI_WINDOW_STATS_TRACE 1
+#else
+#define IMGUI_WINDOW_STATS_TRACE 0
+#endif
+
+namespace CVars
+{
+#if IMGUI_WINDOW_STATS_TRACE
+	TAutoConsoleVariable<int> TraceWindows(TEXT("ImGui.Stats.TraceWindows"), 0,
+		TEXT("Output Insights CPU events for every ImGui window scope.\n")
+		TEXT("0: disabled (default)\n")
+		TEXT("1: enabled"),
+		ECVF_Default);
+#endif // IMGUI_WINDOW_STATS_TRACE
+}
+
+namespace
+{
+	// Weight of the last frame in rolling averages.
+	constexpr float AverageWeight = 0.1f;
+
+	FORCEINLINE void UpdateAverage(float& Average, float Value)
+	{
+		Average += (Value - Average) * AverageWeight;
+	}
+
+	FORCEINLINE FImGuiWindowStats& GetStats(ImGuiContextHook* Hook)
+	{
+		return *static_cast<FImGuiWindowStats*>(Hook->UserData);
+	}
+
+#if IMGUI_WINDOW_STATS_TRACE
+	FORCEINLINE bool IsTracingWindows()
+	{
+		return CVars::TraceWindows.GetValueOnGameThread() > 0 && UE_TRACE_CHANNELEXPR_IS_ENABLED(CpuChannel);
+	}
+#endif // IMGUI_WINDOW_STATS_TRACE
+}
+
+void FImGuiWindowStats::Initialize(ImGuiContext* Context)
+{
+	ImGuiContextHook Hook;
+	Hook.UserData = this;
+
+	Hook.Type = ImGuiContextHookType_BeginWindowPre;
+	Hook.Callback = &FImGuiWindowStats::OnBeginWindowPre;
+	ImGui::AddContextHook(Context, &Hook);
+
+	Hook.Type = ImGuiContextHookType_BeginWindowPost;
+	Hook.Callback = &FImGuiWindowStats::OnBeginWindowPost;
+	ImGui::AddContextHook(Context, &Hook);
+
+	Hook.Type = ImGuiContextHookType_EndWindowPost;
+	Hook.Callback = &FImGuiWindowStats::OnEndWindowPost;
+	ImGui::AddContextHook(Context, &Hook);
+}
+
+void FImGuiWindowStats::AddDrawList(const ImDrawList* Source, const FImGuiDrawList& DrawList)
+{
+	// Draw lists that don't belong to windows (like foreground and background lists) are not attributed.
+	if (const int32* EntryIndex = DrawListEntryIndices.Find(Source))
+	{
+		FWindowEntry& Entry = Entries[*EntryIndex];
+		Entry.FrameVertices += DrawList.NumVertices();
+		Entry.FrameIndices += DrawList.NumIndices();
+		Entry.FrameCommands += DrawList.NumCommands();
+	}
+}
+
+void FImGuiWindowStats::EndFrame()
+{
+	const double MillisecondsPerCycle = FPlatformTime::GetSecondsPerCycle64() * 1000.0;
+
+	for (FWindowEntry& Entry : Entries)
+	{
+		if (Entry.LastActiveFrame == FrameNumber)
+		{
+			UpdateAverage(Entry.InclusiveTime, Entry.FrameInclusiveCycles * MillisecondsPerCycle);
+			UpdateAverage(Entry.ExclusiveTime, (Entry.FrameInclusiveCycles - FMath::Min(Entry.FrameChildCycles, Entry.FrameInclusiveCycles)) * MillisecondsPerCycle);
+			UpdateAverage(Entry.Vertices, Entry.FrameVertices);
+			UpdateAverage(Entry.Indices, Entry.FrameIndices);
+			UpdateAverage(Entry.Commands, Entry.FrameCommands);
+		}
+
+		Entry.FrameInclusiveCycles = Entry.FrameChildCycles = 0;
+		Entry.FrameVertices = Entry.FrameIndices = Entry.FrameCommands = 0;
+	}
+
+	UpdateAverage(TotalTime, FrameTopLevelCycles * MillisecondsPerCycle);
+	FrameTopLevelCycles = 0;
+
+	// Scopes should be closed by now, but this guarantees that mistakes in user code don't accumulate.
+	ScopeStack.Reset();
+
+	FrameNumber++;
+}
+
+void FImGuiWindowStats::OnBeginWindowPre(ImGuiContext* Context, ImGuiContextHook* Hook)
+{
+	GetStats(Hook).PendingStartCycles = FPlatformTime::Cycles64();
+}
+
+void FImGuiWindowStats::OnBeginWindowPost(ImGuiContext* Context, ImGuiContextHook* Hook)
+{
+	FImGuiWindowStats& Stats = GetStats(Hook);
+	ImGuiWindow* Window = Context->CurrentWindow;
+
+	// Fallback window is implicitly opened for the whole frame, so timing it would only duplicate the frame time.
+	if (Window && !Window->IsFallbackWindow)
+	{
+		const int32 EntryIndex = Stats.FindOrAddEntry(Window);
+		Stats.Entries[EntryIndex].LastActiveFrame = Stats.FrameNumber;
+		Stats.ScopeStack.Add({ EntryIndex, Stats.PendingStartCycles, false });
+
+#if IMGUI_WINDOW_STATS_TRACE
+		if (IsTracingWindows())
+		{
+			FCpuProfilerTrace::OutputBeginDynamicEvent(UTF8_TO_TCHAR(Window->Name));
+			Stats.ScopeStack.Last().bTraced = true;
+		}
+#endif // IMGUI_WINDOW_STATS_TRACE
+	}
+}
+
+void FImGuiWindowStats::OnEndWindowPost(ImGuiContext* Context, ImGuiContextHook* Hook)
+{
+	FImGuiWindowStats& Stats = GetStats(Hook);
+
+	// The only window without a scope is the fallback window, which is closed after all the other windows.
+	if (Stats.ScopeStack.Num() > 0)
+	{
+		const FWindowScope Scope = Stats.ScopeStack.Pop();
+		const uint64 Cycles = FPlatformTime::Cycles64() - Scope.StartCycles;
+
+		Stats.Entries[Scope.EntryIndex].FrameInclusiveCycles += Cycles;
+
+		if (Stats.ScopeStack.Num() > 0)
+		{
+			Stats.Entries[Stats.ScopeStack.Last().EntryIndex].FrameChildCycles += Cycles;
+		}
+		else
+		{
+			Stats.FrameTopLevelCycles += Cycles;
+		}
+
+#if IMGUI_WINDOW_STATS_TRACE
+		if (Scope.bTraced)
+		{
+			FCpuProfilerTrace::OutputEndEvent();
+		}
+#endif // IMGUI_WINDOW_STATS_TRACE
+	}
+}
+
+int32 FImGuiWindowStats::FindOrAddEntry(ImGuiWindow* Window)
+{
+	if (const int32* EntryIndex = EntryIndices.Find(Window->ID))
+	{
+		return *EntryIndex;
+	}
+
+	const int32 EntryIndex = Entries.AddDefaulted();
+	Entries[EntryIndex].Window = Window;
+	EntryIndices.Add(Window->ID, EntryIndex);
+	DrawListEntryIndices.Add(Window->DrawList, EntryIndex);
+	return EntryIndex;
+}
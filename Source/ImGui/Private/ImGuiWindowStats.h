@@ -0,0 +1,97 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include <imgui.h>
+
+
+class FImGuiDrawList;
+struct ImGuiContext;
+struct ImGuiContextHook;
+struct ImGuiWindow;
+
+// Per-context table with rolling costs of ImGui windows. CPU time is measured for every Begin/End scope (including
+// child windows) through context hooks and geometry is attributed from draw lists captured at the end of the frame.
+class FImGuiWindowStats
+{
+public:
+
+	struct FWindowEntry
+	{
+		// ImGui windows are never destroyed before their context, so it is safe to keep pointers for the context life.
+		ImGuiWindow* Window = nullptr;
+
+		// Rolling averages.
+		float InclusiveTime = 0.f;
+		float ExclusiveTime = 0.f;
+		float Vertices = 0.f;
+		float Indices = 0.f;
+		float Commands = 0.f;
+
+		// Accumulators for the current frame.
+		uint64 FrameInclusiveCycles = 0;
+		uint64 FrameChildCycles = 0;
+		uint32 FrameVertices = 0;
+		uint32 FrameIndices = 0;
+		uint32 FrameCommands = 0;
+
+		uint32 LastActiveFrame = 0;
+	};
+
+	FImGuiWindowStats() = default;
+
+	FImGuiWindowStats(const FImGuiWindowStats&) = delete;
+	FImGuiWindowStats& operator=(const FImGuiWindowStats&) = delete;
+
+	FImGuiWindowStats(FImGuiWindowStats&&) = delete;
+	FImGuiWindowStats& operator=(FImGuiWindowStats&&) = delete;
+
+	// Install hooks tracking window scopes in the given context. This object must outlive the context.
+	void Initialize(ImGuiContext* Context);
+
+	// Attribute geometry from a draw list transferred from ImGui.
+	// @param Source - ImGui draw list that was the source of data (used to find the owning window)
+	// @param DrawList - Draw list with transferred data
+	void AddDrawList(const ImDrawList* Source, const FImGuiDrawList& DrawList);
+
+	// Update rolling averages with data collected in the last frame. Should be called after draw data is updated.
+	void EndFrame();
+
+	// Get all windows recorded in this context.
+	const TArray<FWindowEntry>& GetEntries() const { return Entries; }
+
+	// Get the number of frames completed since the stats were created.
+	uint32 GetFrameNumber() const { return FrameNumber; }
+
+	// Get the average time of the whole ImGui frame spent in window scopes in milliseconds.
+	float GetTotalTime() const { return TotalTime; }
+
+private:
+
+	struct FWindowScope
+	{
+		int32 EntryIndex;
+		uint64 StartCycles;
+		bool bTraced;
+	};
+
+	static void OnBeginWindowPre(ImGuiContext* Context, ImGuiContextHook* Hook);
+	static void OnBeginWindowPost(ImGuiContext* Context, ImGuiContextHook* Hook);
+	static void OnEndWindowPost(ImGuiContext* Context, ImGuiContextHook* Hook);
+
+	int32 FindOrAddEntry(ImGuiWindow* Window);
+
+	TArray<FWindowEntry> Entries;
+	TMap<ImGuiID, int32> EntryIndices;
+	TMap<const ImDrawList*, int32> DrawListEntryIndices;
+
+	TArray<FWindowScope, TInlineAllocator<16>> ScopeStack;
+
+	uint64 PendingStartCycles = 0;
+	uint64 FrameTopLevelCycles = 0;
+
+	float TotalTime = 0.f;
+	uint32 FrameNumber = 1;
+};
@@ -0,0 +1,66 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiContextProxy.h"
+
+#include <Misc/AutomationTest.h>
+
+#include <imgui_internal.h>
+
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	constexpr const char* TestWindowName = "MemoryCompactTimerTest";
+
+	// Draw a window in one frame, skip it in a few long frames and check whether its buffers were compacted.
+	bool IsUnusedWindowCompacted(ImFontAtlas& FontAtlas, float MemoryCompactTimer)
+	{
+		ImGuiContext* OldContext = ImGui::GetCurrentContext();
+		ImGuiContext* Context = ImGui::CreateContext(&FontAtlas);
+		ImGui::SetCurrentContext(Context);
+
+		ImGuiIO& IO = ImGui::GetIO();
+		IO.IniFilename = nullptr;
+		IO.DisplaySize = ImVec2(1920.f, 1080.f);
+		IO.DeltaTime = 10.f;
+		IO.ConfigMemoryCompactTimer = FImGuiContextProxy::ToImGuiMemoryCompactTimer(MemoryCompactTimer);
+
+		for (int32 Frame = 0; Frame < 4; Frame++)
+		{
+			ImGui::NewFrame();
+			if (Frame == 0)
+			{
+				ImGui::Begin(TestWindowName);
+				ImGui::TextUnformatted("Text");
+				ImGui::End();
+			}
+			ImGui::EndFrame();
+		}
+
+		const ImGuiWindow* Window = ImGui::FindWindowByName(TestWindowName);
+		const bool bCompacted = Window && Window->MemoryCompacted;
+
+		ImGui::DestroyContext(Context);
+		ImGui::SetCurrentContext(OldContext);
+
+		return bCompacted;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FImGuiMemoryCompactTimerTest, "ImGui.MemoryCompactTimer",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FImGuiMemoryCompactTimerTest::RunTest(const FString& Parameters)
+{
+	ImFontAtlas FontAtlas;
+	FontAtlas.AddFontDefault();
+	FontAtlas.Build();
+
+	TestTrue(TEXT("Unused window is compacted after the timer expires"), IsUnusedWindowCompacted(FontAtlas, 1.f));
+	TestFalse(TEXT("Unused window is not compacted when compaction is disabled"), IsUnusedWindowCompacted(FontAtlas, -1.f));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
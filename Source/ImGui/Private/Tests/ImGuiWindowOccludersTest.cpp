@@ -0,0 +1,60 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiWindowOccluders.h"
+
+#include <Misc/AutomationTest.h>
+
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FImGuiWindowOccludersSharedWorldsTest, "ImGui.WindowOccluders.SharedWorlds",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FImGuiWindowOccludersSharedWorldsTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 WorldA = 1;
+	constexpr int32 WorldB = 2;
+
+	const ImRect Cover{ 0.f, 0.f, 200.f, 200.f };
+	const ImRect Window{ 50.f, 50.f, 150.f, 150.f };
+	const ImRect LargerWindow{ 50.f, 50.f, 250.f, 150.f };
+
+	// Windows of one world only occlude windows of the same world.
+	{
+		FImGuiWindowOccluders Occluders;
+		Occluders.Add(Cover, WorldA);
+
+		TestTrue(TEXT("Window of the same world is occluded"), Occluders.IsOccluded(Window, WorldA));
+		TestFalse(TEXT("Window of another world is not occluded"), Occluders.IsOccluded(Window, WorldB));
+		TestFalse(TEXT("Window drawn in all worlds is not occluded by a window of one world"), Occluders.IsOccluded(Window, INDEX_NONE));
+		TestFalse(TEXT("Partially covered window is not occluded"), Occluders.IsOccluded(LargerWindow, WorldA));
+	}
+
+	// Windows drawn in all worlds occlude windows of all worlds.
+	{
+		FImGuiWindowOccluders Occluders;
+		Occluders.Add(Cover, INDEX_NONE);
+
+		TestTrue(TEXT("Window of the first world is occluded by a shared window"), Occluders.IsOccluded(Window, WorldA));
+		TestTrue(TEXT("Window of the second world is occluded by a shared window"), Occluders.IsOccluded(Window, WorldB));
+		TestTrue(TEXT("Shared window is occluded by a shared window"), Occluders.IsOccluded(Window, INDEX_NONE));
+	}
+
+	// Each world keeps its own occluders.
+	{
+		FImGuiWindowOccluders Occluders;
+		Occluders.Add(Cover, WorldA);
+		Occluders.Add(ImRect{ 100.f, 0.f, 300.f, 200.f }, WorldB);
+
+		TestTrue(TEXT("Window covered by its world's occluder is occluded"), Occluders.IsOccluded(ImRect{ 150.f, 50.f, 250.f, 150.f }, WorldB));
+		TestFalse(TEXT("Window covered only by another world's occluder is not occluded"), Occluders.IsOccluded(ImRect{ 150.f, 50.f, 250.f, 150.f }, WorldA));
+		TestFalse(TEXT("Window covered only by a union of occluders of different worlds is not occluded"), Occluders.IsOccluded(LargerWindow, WorldA));
+
+		Occluders.Reset();
+		TestFalse(TEXT("Window is not occluded after reset"), Occluders.IsOccluded(Window, WorldA));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -20,6 +20,9 @@ namespace Utilities
 	// Editor context index. We are lacking flexibility here, so we might need to change it somehow.
 	static constexpr int32 EDITOR_CONTEXT_INDEX = -1;
 
+	// Index of the context shared by all PIE instances, when context sharing is enabled in settings.
+	static constexpr int32 SHARED_PIE_CONTEXT_INDEX = -3;
+
 	FORCEINLINE int32 GetWorldContextIndex(const FWorldContext& WorldContext)
 	{
 		switch (WorldContext.WorldType)
@@ -35,3 +35,19 @@
 #define ENGINE_COMPATIBILITY_LEGACY_KEY_AXIS_API        BELOW_ENGINE_VERSION(4, 26)
 
 #define ENGINE_COMPATIBILITY_LEGACY_VECTOR2F            BELOW_ENGINE_VERSION(5, 0)
+
+// Starting from version 5.0, FVector and FQuat use double precision and single precision types have the 3f and 4f
+// suffixes.
+#define ENGINE_COMPATIBILITY_LEGACY_VECTOR3F            BELOW_ENGINE_VERSION(5, 0)
+
+// Starting from version 4.26, engine has a CPU profiler trace that allows to output Insights events with dynamic names.
+#define ENGINE_COMPATIBILITY_WITH_CPU_PROFILER_TRACE    FROM_ENGINE_VERSION(4, 26)
+
+// Starting from version 4.22, compression formats are identified by names instead of compression flags.
+#define ENGINE_COMPATIBILITY_LEGACY_COMPRESSION_API     BELOW_ENGINE_VERSION(4, 22)
+
+// Starting from version 4.25, reflected properties are FProperty fields instead of UProperty objects.
+#define ENGINE_COMPATIBILITY_LEGACY_UPROPERTY           BELOW_ENGINE_VERSION(4, 25)
+
+// Starting from version 5.5, world line batchers are accessed with UWorld::GetLineBatcher.
+#define ENGINE_COMPATIBILITY_LEGACY_LINE_BATCHERS       BELOW_ENGINE_VERSION(5, 5)
@@ -9,6 +9,7 @@
 #include "ImGuiInputHandlerFactory.h"
 #include "ImGuiModuleManager.h"
 #include "ImGuiModuleSettings.h"
+#include "ImGuiStrings.h"
 #include "TextureManager.h"
 #include "VersionCompatibility.h"
 
@@ -86,10 +87,14 @@ void SImGuiWidget::Construct(const FArguments& InArgs)
 	ModuleManager = InArgs._ModuleManager;
 	GameViewport = InArgs._GameViewport;
 	ContextIndex = InArgs._ContextIndex;
+	WorldContextIndex = Utilities::GetWorldContextIndex(GameViewport->GetWorld());
 
 	// Register to get post-update notifications.
 	ModuleManager->OnPostImGuiUpdate().AddRaw(this, &SImGuiWidget::OnPostImGuiUpdate);
 
+	// Register to release buffers when memory is compacted.
+	ModuleManager->OnCompactMemory().AddRaw(this, &SImGuiWidget::OnCompactMemory);
+
 	// Register debug delegate.
 	auto* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextIndex);
 	checkf(ContextProxy, TEXT("Missing context during widget construction: ContextIndex = %d"), ContextIndex);
@@ -140,6 +145,7 @@ SImGuiWidget::~SImGuiWidget()
 
 	// Unregister from post-update notifications.
 	ModuleManager->OnPostImGuiUpdate().RemoveAll(this);
+	ModuleManager->OnCompactMemory().RemoveAll(this);
 }
 
 void SImGuiWidget::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
@@ -150,6 +156,8 @@ void SImGuiWidget::Tick(const FGeometry& AllottedGeometry, const double InCurren
 	UpdateTransparentMouseInput(AllottedGeometry);
 	HandleWindowFocusLost();
 	UpdateCanvasSize();
+	UpdateVisibleRect(AllottedGeometry);
+	UpdateViewFocus();
 }
 
 FReply SImGuiWidget::OnKeyChar(const FGeometry& MyGeometry, const FCharacterEvent& CharacterEvent)
@@ -599,7 +607,33 @@ void SImGuiWidget::UpdateCanvasSize()
 			CanvasSize /= FMath::Max(DPIScale, 0.01f);
 			CanvasSize = RoundVector(CanvasSize);
 
-			ContextProxy->SetDisplaySize(CanvasSize);
+			ContextProxy->SetDisplaySize(CanvasSize, WorldContextIndex);
+		}
+	}
+}
+
+void SImGuiWidget::UpdateVisibleRect(const FGeometry& AllottedGeometry)
+{
+	if (auto* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextIndex))
+	{
+		// Transform widget bounds to ImGui space, so the context can skip windows that we can't see (e.g. because the
+		// canvas is zoomed in). Canvas transform only scales and translates, so it is enough to transform two corners.
+		const FSlateRenderTransform WidgetToImGui = ImGuiTransform.Inverse();
+		ContextProxy->AddVisibleRect({ WidgetToImGui.TransformPoint(FVector2D::ZeroVector),
+			WidgetToImGui.TransformPoint(AllottedGeometry.GetLocalSize()) });
+	}
+}
+
+void SImGuiWidget::UpdateViewFocus()
+{
+	if (auto* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextIndex))
+	{
+		// In a context shared by multiple worlds, only the focused or hovered view drives input and display size.
+		const bool bHasKeyboardFocus = HasKeyboardFocus();
+		if (bHasKeyboardFocus || IsHovered() || (GameViewport.IsValid() && GameViewport->GetGameViewportWidget().IsValid()
+			&& GameViewport->GetGameViewportWidget()->IsHovered()))
+		{
+			ContextProxy->AddViewFocus(WorldContextIndex, bHasKeyboardFocus);
 		}
 	}
 }
@@ -618,6 +652,11 @@ void SImGuiWidget::OnPostImGuiUpdate()
 	UpdateMouseCursor();
 }
 
+void SImGuiWidget::OnCompactMemory(int64& InOutReclaimedBytes)
+{
+	Painter.CompactMemory(InOutReclaimedBytes);
+}
+
 FVector2D SImGuiWidget::TransformScreenPointToImGui(const FGeometry& MyGeometry, const FVector2D& Point) const
 {
 	const FSlateRenderTransform ImGuiToScreen = ImGuiTransform.Concatenate(MyGeometry.GetAccumulatedRenderTransform());
@@ -638,47 +677,11 @@ int32 SImGuiWidget::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeo
 		const FSlateRenderTransform& WidgetToScreen = AllottedGeometry.GetAccumulatedRenderTransform();
 		const FSlateRenderTransform ImGuiToScreen = RoundTranslation(ImGuiRenderTransform.Concatenate(WidgetToScreen));
 
-#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-		// Convert clipping rectangle to format required by Slate vertex.
-		const FSlateRotatedRect VertexClippingRect{ MyClippingRect };
-#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-
-		for (const auto& DrawList : ContextProxy->GetDrawData())
-		{
-#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-			DrawList.CopyVertexData(VertexBuffer, ImGuiToScreen, VertexClippingRect);
-#else
-			DrawList.CopyVertexData(VertexBuffer, ImGuiToScreen);
-#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-
-			for (int CommandNb = 0; CommandNb < DrawList.NumCommands(); CommandNb++)
-			{
-				const auto& DrawCommand = DrawList.GetCommand(CommandNb, ImGuiToScreen);
-
-				DrawList.CopyIndexData(IndexBuffer, DrawCommand.IdxOffset, DrawCommand.NumElements);
-
-				// Get texture resource handle for this draw command (null index will be also mapped to a valid texture).
-				const FSlateResourceHandle& Handle = ModuleManager->GetTextureManager().GetTextureHandle(DrawCommand.TextureId);
-
-				// Transform clipping rectangle to screen space and apply to elements that we draw.
-				const FSlateRect ClippingRect = DrawCommand.ClippingRect.IntersectionWith(MyClippingRect);
+		// Let the context adapt geometry quality to the scale at which we draw it (e.g. after zooming the canvas out).
+		ContextProxy->AddViewScale(ImGuiToScreen.TransformVector(FVector2D{ 1.f, 0.f }).Size(), DPIScale);
 
-#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-				// Get access to the Slate scissor rectangle defined in Slate Core API, so we can customize elements drawing.
-				extern SLATECORE_API TOptional<FShortRect> GSlateScissorRect;
-				TGuardValue<TOptional<FShortRect>> GSlateScissorRecGuard(GSlateScissorRect, FShortRect{ ClippingRect });
-#else
-				OutDrawElements.PushClip(FSlateClippingZone{ ClippingRect });
-#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-
-				// Add elements to the list.
-				FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId, Handle, VertexBuffer, IndexBuffer, nullptr, 0, 0);
-
-#if !ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-				OutDrawElements.PopClip();
-#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-			}
-		}
+		Painter.Paint(*ContextProxy, ModuleManager->GetTextureManager(), ImGuiToScreen, MyClippingRect, OutDrawElements, LayerId,
+			WorldContextIndex);
 	}
 
 	return Super::OnPaint(Args, AllottedGeometry, MyClippingRect, OutDrawElements, LayerId, WidgetStyle, bParentEnabled);
@@ -737,15 +740,19 @@ namespace
 		ImGui::Text("%s:", Str);
 	}
 
-	void Text(const wchar_t* Str)
+	void Text(FName Name)
+	{
+		ImGui::Text("%s:", FImGuiStrings::ToUTF8(Name));
+	}
+
+	void Text(const FText& Label)
 	{
-		ImGui::Text("%ls:", Str);
+		ImGui::Text("%s:", FImGuiStrings::ToUTF8(Label.ToString()));
 	}
 
-	template<typename CharType = std::enable_if_t<!std::is_same<TCHAR, char>::value && !std::is_same<TCHAR, wchar_t>::value, TCHAR>>
-	void Text(const CharType* Str)
+	void Text(const TCHAR* Str)
 	{
-		ImGui::Text("%ls", TCHAR_TO_WCHAR(Str));
+		ImGui::TextUnformatted(FImGuiStrings::ToUTF8(Str));
 	}
 }
 
@@ -849,6 +856,7 @@ void SImGuiWidget::OnDebugDraw()
 			TwoColumns::CollapsingGroup("Context", [&]()
 			{
 				TwoColumns::Value("Context Index", ContextIndex);
+				TwoColumns::Value("World Context Index", WorldContextIndex);
 				TwoColumns::Value("Context Name", ContextProxy ? *ContextProxy->GetName() : TEXT("< Null >"));
 				TwoColumns::Value("Game Viewport", *GameViewport->GetName());
 			});
@@ -930,7 +938,7 @@ void SImGuiWidget::OnDebugDraw()
 							const uint32 KeyIndex = ImGuiInterops::GetKeyIndex(Key);
 							Styles::TextHighlight(InputState.GetKeys()[KeyIndex], [&]()
 							{
-								TwoColumns::Value(*Key.GetDisplayName().ToString(), KeyIndex);
+								TwoColumns::Value(Key.GetDisplayName(), KeyIndex);
 							});
 						}
 						else
@@ -971,7 +979,7 @@ void SImGuiWidget::OnDebugDraw()
 							const uint32 MouseIndex = ImGuiInterops::GetMouseIndex(Button);
 							Styles::TextHighlight(InputState.GetMouseButtons()[MouseIndex], [&]()
 							{
-								TwoColumns::Value(*Button.GetDisplayName().ToString(), MouseIndex);
+								TwoColumns::Value(Button.GetDisplayName(), MouseIndex);
 							});
 						}
 						else
@@ -4,6 +4,8 @@
 
 #include "ImGuiModuleDebug.h"
 #include "ImGuiModuleSettings.h"
+#include "ImGuiSlatePainter.h"
+#include "Utilities/WorldContextIndex.h"
 
 #include <Rendering/RenderingCommon.h>
 #include <UObject/WeakObjectPtr.h>
@@ -114,10 +116,16 @@ private:
 	void SetCanvasSizeInfo(const FImGuiCanvasSizeInfo& CanvasSizeInfo);
 	void UpdateCanvasSize();
 
+	void UpdateVisibleRect(const FGeometry& AllottedGeometry);
+
+	void UpdateViewFocus();
+
 	void UpdateCanvasControlMode(const FInputEvent& InputEvent);
 
 	void OnPostImGuiUpdate();
 
+	void OnCompactMemory(int64& InOutReclaimedBytes);
+
 	FVector2D TransformScreenPointToImGui(const FGeometry& MyGeometry, const FVector2D& Point) const;
 
 	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& WidgetStyle, bool bParentEnabled) const override;
@@ -137,11 +145,13 @@ private:
 	FSlateRenderTransform ImGuiTransform;
 	FSlateRenderTransform ImGuiRenderTransform;
 
-	mutable TArray<FSlateVertex> VertexBuffer;
-	mutable TArray<SlateIndex> IndexBuffer;
+	mutable FImGuiSlatePainter Painter;
 
 	int32 ContextIndex = 0;
 
+	// Index of the viewport world, which in shared contexts is used to select windows that belong to this widget.
+	int32 WorldContextIndex = Utilities::INVALID_CONTEXT_INDEX;
+
 	FVector2D MinCanvasSize = FVector2D::ZeroVector;
 	FVector2D CanvasSize = FVector2D::ZeroVector;
 
@@ -0,0 +1,59 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+
+class UWorld;
+
+/**
+ * Immediate-mode 3D debug drawing, a batched alternative to DrawDebugLine and related functions for visualisations with
+ * many lines. Calls can be made from any thread and are recorded without locks into compact buffers owned by the
+ * calling thread. Once per frame, during the world post actor tick, buffers from all threads are merged, lines and
+ * shapes outside of view frustums of all local players are culled and the remaining lines are submitted to the world
+ * line batcher in a single call.
+ *
+ * Like non-persistent DrawDebug* lines, everything is visible for one frame, so it should be drawn every frame. Lines
+ * recorded after the world post actor tick (for instance in Slate) are drawn in the next frame. Calls are ignored in
+ * builds without debug drawing (see ENABLE_DRAW_DEBUG).
+ */
+class IMGUI_API FImGuiDebugDraw
+{
+public:
+
+	/**
+	 * Draw a line.
+	 * @param World - World in which the line should be drawn
+	 * @param Start - Start of the line
+	 * @param End - End of the line
+	 * @param Color - Line color
+	 * @param Thickness - Line thickness, where 0 means a single pixel
+	 * @param bForeground - Whether the line should be drawn on top of the scene
+	 */
+	static void Line(const UWorld* World, const FVector& Start, const FVector& End, const FColor& Color, float Thickness = 0.f, bool bForeground = false);
+
+	/**
+	 * Draw edges of an oriented box.
+	 * @param World - World in which the box should be drawn
+	 * @param Center - Center of the box
+	 * @param Extent - Half of the box size in local space
+	 * @param Rotation - Rotation of the box
+	 * @param Color - Line color
+	 * @param Thickness - Line thickness, where 0 means a single pixel
+	 * @param bForeground - Whether the box should be drawn on top of the scene
+	 */
+	static void Box(const UWorld* World, const FVector& Center, const FVector& Extent, const FQuat& Rotation, const FColor& Color, float Thickness = 0.f, bool bForeground = false);
+
+	/**
+	 * Draw a sphere as three orthogonal circles.
+	 * @param World - World in which the sphere should be drawn
+	 * @param Center - Center of the sphere
+	 * @param Radius - Radius of the sphere
+	 * @param Segments - Number of segments in every circle (clamped to range 4-64)
+	 * @param Color - Line color
+	 * @param Thickness - Line thickness, where 0 means a single pixel
+	 * @param bForeground - Whether the sphere should be drawn on top of the scene
+	 */
+	static void Sphere(const UWorld* World, const FVector& Center, float Radius, int32 Segments, const FColor& Color, float Thickness = 0.f, bool bForeground = false);
+};
@@ -2,7 +2,9 @@
 
 #pragma once
 
+#include <Containers/UnrealString.h>
 #include <Delegates/Delegate.h>
+#include <Templates/Function.h>
 
 
 class UWorld;
@@ -57,6 +59,56 @@ public:
 	 * @returns Simple multicast delegate to debug events called once per frame for every world to debug
 	 */
 	static FSimpleMulticastDelegate& OnMultiContextDebug();
+
+	/**
+	 * Add a panel drawn in a named window to ImGui world debug event for current world (GWorld).
+	 * @see AddWorldDebugPanel(UWorld*, const FString&, FSimpleDelegate, FSimpleDelegate)
+	 */
+	static FDelegateHandle AddWorldDebugPanel(const FString& WindowName, FSimpleDelegate Gather, FSimpleDelegate Draw);
+
+	/**
+	 * Add a panel drawn in a named window to ImGui world debug event for given world. Panel work is split into a gather
+	 * step that collects data and a draw step that calls ImGui::Begin with the declared window name and draws collected
+	 * data. Gather step is skipped when the window was not visible in the previous frame, which is when the window was
+	 * collapsed, closed (not submitted) or when its items were skipped because the window was clipped or occluded.
+	 * Draw step is always called, so it can keep the window alive or reopen it. When a hidden window becomes visible,
+	 * its first frame is drawn with data from the last gather.
+	 *
+	 * @param World - World for which we want to add a panel
+	 * @param WindowName - Name of the top-level window passed to ImGui::Begin in the draw step
+	 * @param Gather - Delegate that collects data for the panel (called only if the window is visible)
+	 * @param Draw - Delegate that draws the panel window (called every frame)
+	 * @returns Handle that can be used to remove the panel from the world debug event
+	 */
+	static FDelegateHandle AddWorldDebugPanel(UWorld* World, const FString& WindowName, FSimpleDelegate Gather, FSimpleDelegate Draw);
+
+	/**
+	 * Add a panel built in parallel on a worker thread. Every panel is built in its own scratch context that shares the
+	 * font atlas with the context where it is shown. After being built, panel output is composited into that context as
+	 * a window, which gets its z-order and input from the main context. Panels receive mouse input when hovered (or when
+	 * dragging) and keyboard input when focused, in both cases with one frame of latency.
+	 *
+	 * Draw functions run in parallel with each other and with the game thread, so they should only read data captured
+	 * for them in snapshot functions (which run on the game thread before draw functions start) or data that is
+	 * otherwise thread-safe. Draw functions should only use the public ImGui interface (imgui.h), as inline functions
+	 * from imgui_internal.h bind to the shared context pointer. FImGuiStrings and ImGui overloads taking Unreal strings
+	 * (ImGuiStrings.h) can be only used on the game thread, so strings shown by draw functions should be converted to
+	 * UTF-8 in snapshot functions.
+	 *
+	 * @param World - World whose context should show the panel or null to show it in all contexts
+	 * @param WindowName - Name of the window created by the draw function (it needs to match the name passed to Begin)
+	 * @param Draw - Function called once per frame on a worker thread to build the panel window
+	 * @param Snapshot - Optional function called once per frame on the game thread before the draw function, to
+	 *     capture data for it
+	 * @returns Id of the panel that can be used to remove it
+	 */
+	static int32 AddParallelPanel(const UWorld* World, const FString& WindowName, TFunction<void()> Draw, TFunction<void()> Snapshot = nullptr);
+
+	/**
+	 * Remove a parallel panel. It is safe to call it with an id of a panel that was already removed.
+	 * @param PanelId - Id returned when adding the panel
+	 */
+	static void RemoveParallelPanel(int32 PanelId);
 };
 
 
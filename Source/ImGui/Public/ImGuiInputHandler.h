@@ -4,6 +4,7 @@
 
 #include <CoreMinimal.h>
 #include <Input/Reply.h>
+#include <InputCoreTypes.h>
 #include <UObject/Object.h>
 #include <UObject/WeakObjectPtr.h>
 
@@ -15,7 +16,9 @@ class UGameViewportClient;
 
 struct FAnalogInputEvent;
 struct FCharacterEvent;
+struct FImGuiKeyInfo;
 struct FKeyEvent;
+struct FPropertyChangedEvent;
 
 #if WITH_EDITOR
 class FUICommandInfo;
@@ -172,6 +175,19 @@ private:
 
 	void OnSoftwareCursorChanged(bool);
 
+	// Get routing rules matching the key and modifiers of the event (see EKeyRoute in implementation).
+	uint32 GetKeyRoutes(const FKeyEvent& KeyEvent) const;
+
+	// Compile console keys, the stop play session command and the toggle input key into the routing table.
+	void RebuildKeyRoutes();
+
+	void OnToggleInputKeyChanged(const FImGuiKeyInfo&);
+
+#if WITH_EDITOR
+	void OnObjectPropertyChanged(UObject* Object, FPropertyChangedEvent&);
+	void OnUserDefinedChordChanged(const FUICommandInfo& CommandInfo);
+#endif
+
 	void OnPostImGuiUpdate();
 
 	void Initialize(FImGuiModuleManager* InModuleManager, UGameViewportClient* InGameViewport, int32 InContextIndex);
@@ -194,5 +210,9 @@ private:
 	TSharedPtr<FUICommandInfo> StopPlaySessionCommandInfo;
 #endif
 
+	// Routing rules for keys that need special handling. For each key, there are 4 bits of rules for each of 16
+	// combinations of modifier keys. Keys without rules are not in the table.
+	TMap<FKey, uint64> KeyRoutes;
+
 	friend class FImGuiInputHandlerFactory;
 };
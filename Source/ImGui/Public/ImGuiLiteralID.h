@@ -0,0 +1,128 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "ImGuiSugar.h"
+
+#include <CoreMinimal.h>
+
+#include <imgui.h>
+
+
+/**
+ * ImGui ID of a string literal, hashed at compile time.
+ *
+ * ImGui hashes labels with ImHashStr, a CRC32 seeded with the top of the ID stack, every time they are used. CRC is
+ * linear, so the hash splits into a part that depends only on the label and a linear transformation of the seed. The
+ * first part and the transformation are calculated at compile time and combined with the seed at runtime, without
+ * reading the string. The result is exactly the ID that ImGui would calculate, including the '###' operator, which
+ * restarts hashing from the seed.
+ *
+ * Use IMGUI_ID to create IDs, which guarantees compile-time evaluation:
+ *
+ *     ImGui::PushID(IMGUI_ID("Inventory"));
+ *     ...
+ *     ImGui::PopID();
+ *
+ *     with_LiteralID("Slots") { ... }
+ */
+struct FImGuiLiteralID
+{
+	template<int32 N>
+	explicit constexpr FImGuiLiteralID(const char (&InLabel)[N])
+		: Label(InLabel)
+	{
+		// Hashing restarts from the seed at every '###', so only the part from the last one affects the ID.
+		int32 Length = 0;
+		int32 SeedStart = 0;
+		while (Length < N && InLabel[Length] != '\0')
+		{
+			if (InLabel[Length] == '#' && Length + 2 < N && InLabel[Length + 1] == '#' && InLabel[Length + 2] == '#')
+			{
+				SeedStart = Length;
+			}
+			Length++;
+		}
+
+		// Hash the label with a zero seed state.
+		uint32 State = 0;
+		for (int32 Index = SeedStart; Index < Length; Index++)
+		{
+			State = HashByte(State, static_cast<uint8>(InLabel[Index]));
+		}
+		LabelHash = State;
+
+		// Transformation of the seed state is the same as hashing zero bytes in place of the label.
+		for (int32 Bit = 0; Bit < 32; Bit++)
+		{
+			uint32 Column = 1u << Bit;
+			for (int32 Index = SeedStart; Index < Length; Index++)
+			{
+				Column = HashByte(Column, 0);
+			}
+			SeedColumns[Bit] = Column;
+		}
+	}
+
+	/**
+	 * Get the ID of the label under a seed.
+	 * @param Seed - Seed, usually the top of the ID stack
+	 * @returns The same ID that ImHashStr returns for the label and the seed
+	 */
+	FORCEINLINE ImGuiID Combine(ImGuiID Seed) const
+	{
+		const uint32 SeedState = ~Seed;
+
+		uint32 State = LabelHash;
+		for (int32 Bit = 0; Bit < 32; Bit++)
+		{
+			State ^= SeedColumns[Bit] & (0u - ((SeedState >> Bit) & 1u));
+		}
+		return ~State;
+	}
+
+	// Label from which this ID was created.
+	const char* Label;
+
+	// Hash state after hashing the label with a zero seed state.
+	uint32 LabelHash = 0;
+
+	// Images of seed state bits after hashing the label.
+	uint32 SeedColumns[32] = {};
+
+private:
+
+	// One step of ImHashStr (reflected CRC32 without the lookup table).
+	static constexpr uint32 HashByte(uint32 State, uint8 Byte)
+	{
+		State ^= Byte;
+		for (int32 Bit = 0; Bit < 8; Bit++)
+		{
+			State = (State >> 1) ^ (0xEDB88320u & (0u - (State & 1u)));
+		}
+		return State;
+	}
+};
+
+// Get the compile-time hashed ID of a string literal.
+#define IMGUI_ID(Literal) ([]() -> const FImGuiLiteralID& { static constexpr FImGuiLiteralID LiteralID(Literal); return LiteralID; }())
+
+namespace ImGui
+{
+	/**
+	 * Get the ID of a string literal in the current window, like GetID(const char*) but without hashing the string.
+	 * @param ID - Literal ID created with IMGUI_ID
+	 * @returns ID combined with the top of the ID stack
+	 */
+	IMGUI_API ImGuiID GetID(const FImGuiLiteralID& ID);
+
+	/**
+	 * Push a string literal into the ID stack, like PushID(const char*) but without hashing the string.
+	 * @param ID - Literal ID created with IMGUI_ID
+	 */
+	IMGUI_API void PushID(const FImGuiLiteralID& ID);
+}
+
+// Scoped PushID of a string literal, in the style of ImGuiSugar (see with_ID and set_ID).
+#define with_LiteralID(Literal)      IMGUI_SUGAR_SCOPED_VOID_N(ImGui::PushID,                 ImGui::PopID,                 IMGUI_ID(Literal))
+#define set_LiteralID(Literal)       IMGUI_SUGAR_PARENT_SCOPED_VOID_N(ImGui::PushID,          ImGui::PopID,                 IMGUI_ID(Literal))
@@ -9,6 +9,8 @@
 #include <Modules/ModuleManager.h>
 
 
+struct ImFont;
+
 class FImGuiModule : public IModuleInterface
 {
 public:
@@ -120,6 +122,18 @@ public:
 
 	virtual void RebuildFontAtlas();
 
+	/**
+	 * Get a font from the font atlas shared by ImGui contexts. Custom fonts added as lazy are requested on the first
+	 * call and built in the background. Until they are ready, the default font is returned.
+	 *
+	 * Fonts are released a few frames after the font atlas is rebuilt, so returned pointers should not be kept
+	 * between frames.
+	 *
+	 * @param FontName - Name of a custom font (see FImGuiModuleProperties::AddCustomFont)
+	 * @returns Requested font, default font if the requested one is not ready or null if there is no font atlas
+	 */
+	virtual ImFont* GetFont(FName FontName);
+
 	/**
 	 * Get ImGui module properties.
 	 *
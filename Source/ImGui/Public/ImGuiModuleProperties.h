@@ -72,14 +72,62 @@ public:
 	/** Toggle ImGui demo. */
 	void ToggleDemo() { SetShowDemo(!ShowDemo()); }
 
-	/** Adds a new font to initialize */
-	void AddCustomFont(FName FontName, TSharedPtr<ImFontConfig> Font) { CustomFonts.Emplace(FontName, Font); }
+	/** Check whether ImGui stats are visible. */
+	bool ShowStats() const { return bShowStats; }
+
+	/** Show or hide ImGui stats. */
+	void SetShowStats(bool bShow) { bShowStats = bShow; }
+
+	/** Toggle ImGui stats. */
+	void ToggleStats() { SetShowStats(!ShowStats()); }
+
+	/** Check whether ImGui memory panel is visible. */
+	bool ShowMemory() const { return bShowMemory; }
+
+	/** Show or hide ImGui memory panel. */
+	void SetShowMemory(bool bShow) { bShowMemory = bShow; }
+
+	/** Toggle ImGui memory panel. */
+	void ToggleMemory() { SetShowMemory(!ShowMemory()); }
+
+	/** Check whether ImGui command palette is visible. */
+	bool ShowCommandPalette() const { return bShowCommandPalette; }
+
+	/** Show or hide ImGui command palette. */
+	void SetShowCommandPalette(bool bShow) { bShowCommandPalette = bShow; }
+
+	/** Toggle ImGui command palette. */
+	void ToggleCommandPalette() { SetShowCommandPalette(!ShowCommandPalette()); }
+
+	/**
+	 * Adds a new font to initialize.
+	 *
+	 * @param FontName - Name used to find the font (see FImGuiModule::GetFont)
+	 * @param Font - Font configuration (font data is copied to font atlases, so it stays owned by the caller)
+	 * @param bLazy - If true, the font is not added to the font atlas until it is requested for the first time
+	 */
+	void AddCustomFont(FName FontName, TSharedPtr<ImFontConfig> Font, bool bLazy = false)
+	{
+		CustomFonts.Emplace(FontName, Font);
+		if (bLazy)
+		{
+			LazyCustomFonts.Add(FontName);
+		}
+		else
+		{
+			LazyCustomFonts.Remove(FontName);
+		}
+	}
 
 	/** Removes a font from the custom font list */
-	void RemoveCustomFont(FName FontName) { CustomFonts.Remove(FontName); }
+	void RemoveCustomFont(FName FontName) { CustomFonts.Remove(FontName); LazyCustomFonts.Remove(FontName); }
 
 	/** Gets the map of registered custom fonts */
 	TMap<FName, TSharedPtr<ImFontConfig>>& GetCustomFonts() { return CustomFonts; }
+	const TMap<FName, TSharedPtr<ImFontConfig>>& GetCustomFonts() const { return CustomFonts; }
+
+	/** Checks whether a custom font is added to the font atlas only after it is requested */
+	bool IsCustomFontLazy(FName FontName) const { return LazyCustomFonts.Contains(FontName); }
 
 private:
 
@@ -93,6 +141,10 @@ private:
 	bool bMouseInputShared = false;
 
 	bool bShowDemo = false;
+	bool bShowStats = false;
+	bool bShowMemory = false;
+	bool bShowCommandPalette = false;
 
 	TMap<FName, TSharedPtr<ImFontConfig>> CustomFonts;
+	TSet<FName> LazyCustomFonts;
 };
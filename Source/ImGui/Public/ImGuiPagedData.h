@@ -0,0 +1,305 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Async/Async.h>
+
+
+/**
+ * Source of rows for TImGuiPagedData.
+ */
+template<typename RowType>
+class TImGuiPagedDataProvider
+{
+public:
+
+	virtual ~TImGuiPagedDataProvider() = default;
+
+	/**
+	 * Get the number of rows. Called on the game thread once per update.
+	 * @returns Number of rows
+	 */
+	virtual int32 GetNumRows() const = 0;
+
+	/**
+	 * Fetch a range of rows. Called on background threads, possibly in parallel for different ranges.
+	 * @param FirstRow - Index of the first row to fetch
+	 * @param NumRows - Number of rows to fetch (the range is always within the number of rows)
+	 * @param OutRows - Empty array to which fetched rows should be added
+	 */
+	virtual void FetchRows(int32 FirstRow, int32 NumRows, TArray<RowType>& OutRows) const = 0;
+
+	/**
+	 * Get the memory used by fetched rows, which is counted against the cache budget. Override if rows own memory.
+	 * @param Rows - Rows of one page
+	 * @returns Size in bytes
+	 */
+	virtual SIZE_T GetAllocatedSize(const TArray<RowType>& Rows) const { return Rows.GetAllocatedSize(); }
+};
+
+/**
+ * Settings of TImGuiPagedData.
+ */
+struct FImGuiPagedDataSettings
+{
+	/** Number of rows fetched together. */
+	int32 RowsPerPage = 256;
+
+	/** Number of pages before and after the visible range that are fetched in advance. */
+	int32 PrefetchPages = 1;
+
+	/** Maximal number of pages fetched at the same time. */
+	int32 MaxLoadingPages = 4;
+
+	/** Memory budget of cached pages in bytes. Pages in the visible and prefetch range are kept even above budget. */
+	SIZE_T MemoryBudget = 16 * 1024 * 1024;
+};
+
+/**
+ * Rows fetched on demand from a provider, for lists and tables drawn with ImGuiListClipper over datasets that are too
+ * big to keep in memory or too slow to fetch on the game thread. Rows are fetched in fixed-size pages on background
+ * tasks. Pages in the visible range requested by the clipper are fetched first, followed by pages in the prefetch
+ * margin. Fetched pages are kept in a cache with a memory budget, from which least recently requested pages are evicted.
+ * Rows that are still loading should be drawn as placeholders.
+ *
+ *     Rows.Update();
+ *
+ *     ImGuiListClipper Clipper;
+ *     Clipper.Begin(Rows.GetNumRows(), ImGui::GetTextLineHeightWithSpacing());
+ *     while (Clipper.Step())
+ *     {
+ *         Rows.Request(Clipper.DisplayStart, Clipper.DisplayEnd);
+ *         for (int32 Index = Clipper.DisplayStart; Index < Clipper.DisplayEnd; Index++)
+ *         {
+ *             if (const FRow* Row = Rows.Find(Index)) { ... } else { ImGui::TextDisabled("Loading..."); }
+ *         }
+ *     }
+ *
+ * Passing the row height to the clipper skips the step that measures the first row, which would otherwise keep the
+ * first page requested. Paged data should only be used on the game thread.
+ */
+template<typename RowType>
+class TImGuiPagedData
+{
+public:
+
+	using FProvider = TImGuiPagedDataProvider<RowType>;
+
+	/**
+	 * Create paged data.
+	 * @param InProvider - Provider of rows, shared with background tasks
+	 * @param InSettings - Page size, prefetch margin and cache budget
+	 */
+	explicit TImGuiPagedData(const TSharedRef<const FProvider, ESPMode::ThreadSafe>& InProvider, const FImGuiPagedDataSettings& InSettings = {})
+		: Provider(InProvider)
+		, Settings(InSettings)
+	{
+		Settings.RowsPerPage = FMath::Max(Settings.RowsPerPage, 1);
+		Settings.PrefetchPages = FMath::Max(Settings.PrefetchPages, 0);
+		Settings.MaxLoadingPages = FMath::Max(Settings.MaxLoadingPages, 1);
+	}
+
+	TImGuiPagedData(const TImGuiPagedData&) = delete;
+	TImGuiPagedData& operator=(const TImGuiPagedData&) = delete;
+
+	TImGuiPagedData(TImGuiPagedData&&) = delete;
+	TImGuiPagedData& operator=(TImGuiPagedData&&) = delete;
+
+	/**
+	 * Collect fetched pages and evict pages above the budget. Should be called once per frame before drawing.
+	 */
+	void Update()
+	{
+		NumRows = FMath::Max(Provider->GetNumRows(), 0);
+
+		for (auto It = LoadingPages.CreateIterator(); It; ++It)
+		{
+			if (It->Value.Task.IsReady())
+			{
+				FPage& Page = Pages.Add(It->Key);
+				Page.Rows = MoveTemp(*It->Value.Rows);
+				Page.Size = Provider->GetAllocatedSize(Page.Rows);
+				Page.LastUsed = ++UseCounter;
+				CachedSize += Page.Size;
+
+				It.RemoveCurrent();
+			}
+		}
+
+		Evict();
+
+		// Requests from this frame replace protected ranges.
+		RequestedRanges.Reset();
+	}
+
+	/**
+	 * Request a range of rows together with the prefetch margin. Visible pages that are not cached start loading.
+	 * @param FirstRow - Index of the first visible row (like ImGuiListClipper::DisplayStart)
+	 * @param EndRow - Index after the last visible row (like ImGuiListClipper::DisplayEnd)
+	 */
+	void Request(int32 FirstRow, int32 EndRow)
+	{
+		FirstRow = FMath::Max(FirstRow, 0);
+		EndRow = FMath::Min(EndRow, NumRows);
+		if (EndRow <= FirstRow)
+		{
+			return;
+		}
+
+		const int32 FirstVisiblePage = FirstRow / Settings.RowsPerPage;
+		const int32 LastVisiblePage = (EndRow - 1) / Settings.RowsPerPage;
+		RequestedRanges.Emplace(FirstVisiblePage - Settings.PrefetchPages, LastVisiblePage + Settings.PrefetchPages);
+
+		// Visible pages go first, followed by prefetched pages in order of their distance from the visible range.
+		for (int32 PageIndex = FirstVisiblePage; PageIndex <= LastVisiblePage; PageIndex++)
+		{
+			RequestPage(PageIndex);
+		}
+
+		for (int32 Distance = 1; Distance <= Settings.PrefetchPages; Distance++)
+		{
+			RequestPage(FirstVisiblePage - Distance);
+			RequestPage(LastVisiblePage + Distance);
+		}
+	}
+
+	/**
+	 * Get a row if its page is cached.
+	 * @param Row - Index of the row
+	 * @returns Pointer to the row or null if the row is still loading or out of range
+	 */
+	const RowType* Find(int32 Row) const
+	{
+		if (Row >= 0)
+		{
+			const int32 PageIndex = Row / Settings.RowsPerPage;
+			if (const FPage* Page = Pages.Find(PageIndex))
+			{
+				const int32 RowInPage = Row - PageIndex * Settings.RowsPerPage;
+				return Page->Rows.IsValidIndex(RowInPage) ? &Page->Rows[RowInPage] : nullptr;
+			}
+		}
+		return nullptr;
+	}
+
+	/**
+	 * Drop all cached pages and forget pages that are loading, so rows are fetched again (tasks that are already
+	 * running finish in the background but their results are ignored).
+	 */
+	void Invalidate()
+	{
+		Pages.Empty();
+		LoadingPages.Empty();
+		CachedSize = 0;
+	}
+
+	/** Get the number of rows from the last update. */
+	int32 GetNumRows() const { return NumRows; }
+
+	/** Get the number of cached pages. */
+	int32 GetNumCachedPages() const { return Pages.Num(); }
+
+	/** Get the number of pages that are loading. */
+	int32 GetNumLoadingPages() const { return LoadingPages.Num(); }
+
+	/** Get the memory used by cached pages in bytes. */
+	SIZE_T GetCachedSize() const { return CachedSize; }
+
+	/** Get paged data settings. */
+	const FImGuiPagedDataSettings& GetSettings() const { return Settings; }
+
+private:
+
+	struct FPage
+	{
+		TArray<RowType> Rows;
+		SIZE_T Size = 0;
+		uint64 LastUsed = 0;
+	};
+
+	struct FLoadingPage
+	{
+		TSharedRef<TArray<RowType>, ESPMode::ThreadSafe> Rows;
+		TFuture<void> Task;
+	};
+
+	int32 GetNumPages() const
+	{
+		return (NumRows + Settings.RowsPerPage - 1) / Settings.RowsPerPage;
+	}
+
+	void RequestPage(int32 PageIndex)
+	{
+		if (PageIndex < 0 || PageIndex >= GetNumPages())
+		{
+			return;
+		}
+
+		if (FPage* Page = Pages.Find(PageIndex))
+		{
+			Page->LastUsed = ++UseCounter;
+		}
+		else if (!LoadingPages.Contains(PageIndex) && LoadingPages.Num() < Settings.MaxLoadingPages)
+		{
+			const int32 FirstRow = PageIndex * Settings.RowsPerPage;
+			const int32 PageRows = FMath::Min(Settings.RowsPerPage, NumRows - FirstRow);
+
+			// Task only references shared data, so it can safely outlive this object.
+			TSharedRef<TArray<RowType>, ESPMode::ThreadSafe> Rows = MakeShared<TArray<RowType>, ESPMode::ThreadSafe>();
+			TFuture<void> Task = Async(EAsyncExecution::ThreadPool, [Provider = Provider, Rows, FirstRow, PageRows]()
+			{
+				Provider->FetchRows(FirstRow, PageRows, *Rows);
+			});
+
+			LoadingPages.Add(PageIndex, FLoadingPage{ MoveTemp(Rows), MoveTemp(Task) });
+		}
+	}
+
+	bool IsRequested(int32 PageIndex) const
+	{
+		return RequestedRanges.ContainsByPredicate([PageIndex](const TPair<int32, int32>& Range)
+		{
+			return PageIndex >= Range.Key && PageIndex <= Range.Value;
+		});
+	}
+
+	void Evict()
+	{
+		while (CachedSize > Settings.MemoryBudget)
+		{
+			// Find the least recently used page outside of the ranges requested in the last frame.
+			int32 EvictedPage = INDEX_NONE;
+			uint64 OldestUse = MAX_uint64;
+			for (const TPair<int32, FPage>& Entry : Pages)
+			{
+				if (Entry.Value.LastUsed < OldestUse && !IsRequested(Entry.Key))
+				{
+					EvictedPage = Entry.Key;
+					OldestUse = Entry.Value.LastUsed;
+				}
+			}
+
+			if (EvictedPage == INDEX_NONE)
+			{
+				break;
+			}
+
+			CachedSize -= Pages.FindChecked(EvictedPage).Size;
+			Pages.Remove(EvictedPage);
+		}
+	}
+
+	TSharedRef<const FProvider, ESPMode::ThreadSafe> Provider;
+	FImGuiPagedDataSettings Settings;
+
+	TMap<int32, FPage> Pages;
+	TMap<int32, FLoadingPage> LoadingPages;
+
+	// Page ranges (including prefetch margins) requested since the last update, which are protected from eviction.
+	TArray<TPair<int32, int32>, TInlineAllocator<4>> RequestedRanges;
+
+	SIZE_T CachedSize = 0;
+	uint64 UseCounter = 0;
+	int32 NumRows = 0;
+};
@@ -0,0 +1,61 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include <imgui.h>
+
+
+/**
+ * Single sprite in a batch drawn with ImGui::AddSprites. Min and Max must stay next to each other, as they are loaded
+ * together into one vector register during clipping.
+ */
+struct FImGuiSprite
+{
+	/** Upper-left corner in draw list coordinates. */
+	ImVec2 Min;
+
+	/** Lower-right corner in draw list coordinates. */
+	ImVec2 Max;
+
+	/** Texture coordinates of the upper-left corner. */
+	ImVec2 UVMin = ImVec2(0.f, 0.f);
+
+	/** Texture coordinates of the lower-right corner. */
+	ImVec2 UVMax = ImVec2(1.f, 1.f);
+
+	/** Colour multiplied with the texture. */
+	ImU32 Color = IM_COL32_WHITE;
+};
+
+namespace ImGui
+{
+	/**
+	 * Add a batch of textured quads sharing one texture to a draw list. Compared to calling ImDrawList::AddImage for
+	 * every sprite, buffers are reserved once per batch and quads are written in one tight loop, which makes it suitable
+	 * for thousands of sprites per frame (particles, icons, tiles, etc.).
+	 *
+	 * Large batches are split to respect 16-bit indices. If the renderer cannot offset vertices, sprites that don't fit
+	 * into the current draw command are dropped.
+	 *
+	 * @param DrawList - Draw list to which sprites should be added
+	 * @param TextureId - Texture used by all sprites in the batch
+	 * @param Sprites - Array of sprites
+	 * @param NumSprites - Number of sprites in the array
+	 * @param bClip - Whether to skip sprites that are completely outside of the current clip rectangle
+	 */
+	IMGUI_API void AddSprites(ImDrawList* DrawList, ImTextureID TextureId, const FImGuiSprite* Sprites, int32 NumSprites, bool bClip = true);
+
+	/**
+	 * Add a batch of textured quads sharing one texture to a draw list.
+	 * @param DrawList - Draw list to which sprites should be added
+	 * @param TextureId - Texture used by all sprites in the batch
+	 * @param Sprites - Sprites to add
+	 * @param bClip - Whether to skip sprites that are completely outside of the current clip rectangle
+	 */
+	FORCEINLINE void AddSprites(ImDrawList* DrawList, ImTextureID TextureId, TArrayView<const FImGuiSprite> Sprites, bool bClip = true)
+	{
+		AddSprites(DrawList, TextureId, Sprites.GetData(), Sprites.Num(), bClip);
+	}
+}
@@ -0,0 +1,54 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include <imgui.h>
+
+
+/**
+ * Conversions of Unreal strings to UTF-8 strings that can be passed to ImGui without temporary buffers.
+ *
+ * Names are converted once and cached for the module life, so returned pointers are always valid. Strings are cached
+ * for the current frame and returned pointers are valid until the end of the frame (which is enough for ImGui calls
+ * as they copy or hash labels immediately). Functions should be only called from the game thread, which excludes
+ * draw functions of parallel panels (see FImGuiDelegates::AddParallelPanel).
+ */
+class IMGUI_API FImGuiStrings
+{
+public:
+
+	/**
+	 * Get a UTF-8 representation of a name. Conversion is done only the first time the name is used.
+	 * @param Name - Name to convert
+	 * @returns Null-terminated UTF-8 string valid for the module life
+	 */
+	static const char* ToUTF8(FName Name);
+
+	/**
+	 * Get a UTF-8 representation of a string. The same strings used during one frame are converted only once.
+	 * @param Str - Null-terminated string to convert
+	 * @returns Null-terminated UTF-8 string valid until the end of the frame
+	 */
+	static const char* ToUTF8(const TCHAR* Str);
+
+	/**
+	 * Get a UTF-8 representation of a string. The same strings used during one frame are converted only once.
+	 * @param Str - String to convert
+	 * @returns Null-terminated UTF-8 string valid until the end of the frame
+	 */
+	static const char* ToUTF8(const FString& Str);
+};
+
+// Overloads of ImGui functions taking Unreal strings directly. Text is not formatted.
+namespace ImGui
+{
+	FORCEINLINE void Text(FName Name) { TextUnformatted(FImGuiStrings::ToUTF8(Name)); }
+	FORCEINLINE void Text(const TCHAR* Str) { TextUnformatted(FImGuiStrings::ToUTF8(Str)); }
+	FORCEINLINE void Text(const FString& Str) { TextUnformatted(FImGuiStrings::ToUTF8(Str)); }
+
+	FORCEINLINE bool Button(FName Label, const ImVec2& Size = ImVec2(0, 0)) { return Button(FImGuiStrings::ToUTF8(Label), Size); }
+	FORCEINLINE bool Button(const TCHAR* Label, const ImVec2& Size = ImVec2(0, 0)) { return Button(FImGuiStrings::ToUTF8(Label), Size); }
+	FORCEINLINE bool Button(const FString& Label, const ImVec2& Size = ImVec2(0, 0)) { return Button(FImGuiStrings::ToUTF8(Label), Size); }
+}
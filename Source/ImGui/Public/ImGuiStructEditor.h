@@ -0,0 +1,399 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "ImGuiStrings.h"
+
+#include <CoreMinimal.h>
+
+#include <imgui.h>
+
+#include <type_traits>
+
+
+/**
+ * Editors for plain C++ structs generated at compile time.
+ *
+ * Fields are listed once, next to the struct, and templates generate the editing and display code from that list.
+ * Every field is dispatched by its type to a matching widget, so there are no string lookups, no virtual calls and no
+ * reflection data at runtime. Labels are string literals with field names.
+ *
+ * Supported field types are bool, integer and floating point scalars, enums (edited as their underlying values),
+ * FVector, FVector2D, FRotator, FLinearColor, FColor, FString and FName (both displayed only), TArrays of supported
+ * types and other structs with field lists. Fields of other types fail to compile.
+ *
+ * Field lists need to be declared in the global namespace:
+ *
+ *     IMGUI_STRUCT_BEGIN(FMyData)
+ *         IMGUI_STRUCT_FIELD(Speed)
+ *         IMGUI_STRUCT_FIELD(Offset)
+ *         IMGUI_STRUCT_FIELD(Targets)
+ *     IMGUI_STRUCT_END()
+ *
+ *     // In a window.
+ *     if (ImGui::EditStruct("My Data", Data)) { ... }
+ */
+template<typename T>
+struct TImGuiStructFields
+{
+	static constexpr bool bDefined = false;
+};
+
+#define IMGUI_STRUCT_BEGIN(Type) \
+	template<> \
+	struct TImGuiStructFields<Type> \
+	{ \
+		static constexpr bool bDefined = true; \
+		template<typename TStruct, typename TVisitor> \
+		static void Visit(TStruct& Value, TVisitor& Visitor) \
+		{
+
+#define IMGUI_STRUCT_FIELD(Name) \
+			Visitor(#Name, Value.Name);
+
+#define IMGUI_STRUCT_END() \
+		} \
+	};
+
+
+namespace ImGuiStructEditor
+{
+	//====================================================================================================
+	// Type traits
+	//====================================================================================================
+
+	// ImGui data types of scalars and types used to print them.
+	template<typename T> struct TScalar { static constexpr bool bSupported = false; };
+
+	template<ImGuiDataType InDataType, typename TInPrintType>
+	struct TScalarInfo
+	{
+		static constexpr bool bSupported = true;
+		static constexpr ImGuiDataType DataType = InDataType;
+		using FPrintType = TInPrintType;
+	};
+
+	template<> struct TScalar<int8> : TScalarInfo<ImGuiDataType_S8, int> { static constexpr const char* Format = "%d"; };
+	template<> struct TScalar<uint8> : TScalarInfo<ImGuiDataType_U8, unsigned> { static constexpr const char* Format = "%u"; };
+	template<> struct TScalar<int16> : TScalarInfo<ImGuiDataType_S16, int> { static constexpr const char* Format = "%d"; };
+	template<> struct TScalar<uint16> : TScalarInfo<ImGuiDataType_U16, unsigned> { static constexpr const char* Format = "%u"; };
+	template<> struct TScalar<int32> : TScalarInfo<ImGuiDataType_S32, int> { static constexpr const char* Format = "%d"; };
+	template<> struct TScalar<uint32> : TScalarInfo<ImGuiDataType_U32, unsigned> { static constexpr const char* Format = "%u"; };
+	template<> struct TScalar<int64> : TScalarInfo<ImGuiDataType_S64, long long> { static constexpr const char* Format = "%lld"; };
+	template<> struct TScalar<uint64> : TScalarInfo<ImGuiDataType_U64, unsigned long long> { static constexpr const char* Format = "%llu"; };
+	template<> struct TScalar<float> : TScalarInfo<ImGuiDataType_Float, double> { static constexpr const char* Format = "%.3f"; };
+	template<> struct TScalar<double> : TScalarInfo<ImGuiDataType_Double, double> { static constexpr const char* Format = "%.3f"; };
+
+	template<typename T>
+	constexpr float GetDragSpeed() { return std::is_floating_point<T>::value ? 0.1f : 1.f; }
+
+	//====================================================================================================
+	// Declarations (all overloads need to be visible before visitors that call them)
+	//====================================================================================================
+
+	inline bool Edit(const char* Label, bool& Value);
+	inline bool Edit(const char* Label, FVector& Value);
+	inline bool Edit(const char* Label, FVector2D& Value);
+	inline bool Edit(const char* Label, FRotator& Value);
+	inline bool Edit(const char* Label, FLinearColor& Value);
+	inline bool Edit(const char* Label, FColor& Value);
+	inline bool Edit(const char* Label, FString& Value);
+	inline bool Edit(const char* Label, FName& Value);
+
+	template<typename T>
+	typename TEnableIf<TScalar<T>::bSupported, bool>::Type Edit(const char* Label, T& Value);
+
+	template<typename T>
+	typename TEnableIf<std::is_enum<T>::value, bool>::Type Edit(const char* Label, T& Value);
+
+	template<typename T>
+	typename TEnableIf<TImGuiStructFields<T>::bDefined, bool>::Type Edit(const char* Label, T& Value);
+
+	template<typename T, typename TAllocator>
+	bool Edit(const char* Label, TArray<T, TAllocator>& Values);
+
+	inline void View(const char* Label, bool Value);
+	inline void View(const char* Label, const FVector& Value);
+	inline void View(const char* Label, const FVector2D& Value);
+	inline void View(const char* Label, const FRotator& Value);
+	inline void View(const char* Label, const FLinearColor& Value);
+	inline void View(const char* Label, const FColor& Value);
+	inline void View(const char* Label, const FString& Value);
+	inline void View(const char* Label, const FName& Value);
+
+	template<typename T>
+	typename TEnableIf<TScalar<T>::bSupported>::Type View(const char* Label, const T& Value);
+
+	template<typename T>
+	typename TEnableIf<std::is_enum<T>::value>::Type View(const char* Label, const T& Value);
+
+	template<typename T>
+	typename TEnableIf<TImGuiStructFields<T>::bDefined>::Type View(const char* Label, const T& Value);
+
+	template<typename T, typename TAllocator>
+	void View(const char* Label, const TArray<T, TAllocator>& Values);
+
+	//====================================================================================================
+	// Field visitors
+	//====================================================================================================
+
+	struct FEditVisitor
+	{
+		template<typename TField>
+		FORCEINLINE void operator()(const char* Name, TField& Field) { bChanged |= Edit(Name, Field); }
+
+		bool bChanged = false;
+	};
+
+	struct FViewVisitor
+	{
+		template<typename TField>
+		FORCEINLINE void operator()(const char* Name, const TField& Field) { View(Name, Field); }
+	};
+
+	template<typename T>
+	bool EditFields(T& Value)
+	{
+		FEditVisitor Visitor;
+		TImGuiStructFields<T>::Visit(Value, Visitor);
+		return Visitor.bChanged;
+	}
+
+	template<typename T>
+	void ViewFields(const T& Value)
+	{
+		FViewVisitor Visitor;
+		TImGuiStructFields<T>::Visit(Value, Visitor);
+	}
+
+	//====================================================================================================
+	// Editors
+	//====================================================================================================
+
+	inline bool Edit(const char* Label, bool& Value)
+	{
+		return ImGui::Checkbox(Label, &Value);
+	}
+
+	// Components of vectors and rotators are contiguous and can be edited as arrays (of floats or doubles, depending on
+	// the engine version).
+	template<typename TComponent>
+	bool EditComponents(const char* Label, TComponent* Components, int32 NumComponents)
+	{
+		return ImGui::DragScalarN(Label, TScalar<TComponent>::DataType, Components, NumComponents, GetDragSpeed<TComponent>());
+	}
+
+	inline bool Edit(const char* Label, FVector& Value) { return EditComponents(Label, &Value.X, 3); }
+	inline bool Edit(const char* Label, FVector2D& Value) { return EditComponents(Label, &Value.X, 2); }
+	inline bool Edit(const char* Label, FRotator& Value) { return EditComponents(Label, &Value.Pitch, 3); }
+
+	inline bool Edit(const char* Label, FLinearColor& Value)
+	{
+		return ImGui::ColorEdit4(Label, &Value.R);
+	}
+
+	inline bool Edit(const char* Label, FColor& Value)
+	{
+		FLinearColor Color = Value.ReinterpretAsLinear();
+		if (ImGui::ColorEdit4(Label, &Color.R))
+		{
+			Value = Color.QuantizeRound();
+			return true;
+		}
+		return false;
+	}
+
+	inline bool Edit(const char* Label, FString& Value)
+	{
+		View(Label, Value);
+		return false;
+	}
+
+	inline bool Edit(const char* Label, FName& Value)
+	{
+		View(Label, Value);
+		return false;
+	}
+
+	template<typename T>
+	typename TEnableIf<TScalar<T>::bSupported, bool>::Type Edit(const char* Label, T& Value)
+	{
+		return ImGui::DragScalar(Label, TScalar<T>::DataType, &Value, GetDragSpeed<T>());
+	}
+
+	template<typename T>
+	typename TEnableIf<std::is_enum<T>::value, bool>::Type Edit(const char* Label, T& Value)
+	{
+		typename std::underlying_type<T>::type RawValue = static_cast<typename std::underlying_type<T>::type>(Value);
+		if (Edit(Label, RawValue))
+		{
+			Value = static_cast<T>(RawValue);
+			return true;
+		}
+		return false;
+	}
+
+	template<typename T>
+	typename TEnableIf<TImGuiStructFields<T>::bDefined, bool>::Type Edit(const char* Label, T& Value)
+	{
+		bool bChanged = false;
+		if (ImGui::TreeNode(Label))
+		{
+			bChanged = EditFields(Value);
+			ImGui::TreePop();
+		}
+		return bChanged;
+	}
+
+	template<typename T, typename TAllocator>
+	bool Edit(const char* Label, TArray<T, TAllocator>& Values)
+	{
+		bool bChanged = false;
+		if (ImGui::TreeNode(Label, "%s [%d]", Label, Values.Num()))
+		{
+			for (int32 Index = 0; Index < Values.Num(); Index++)
+			{
+				char ElementLabel[16];
+				FCStringAnsi::Snprintf(ElementLabel, sizeof(ElementLabel), "[%d]", Index);
+				bChanged |= Edit(ElementLabel, Values[Index]);
+			}
+			ImGui::TreePop();
+		}
+		return bChanged;
+	}
+
+	//====================================================================================================
+	// Views
+	//====================================================================================================
+
+	inline void View(const char* Label, bool Value)
+	{
+		ImGui::LabelText(Label, "%s", Value ? "true" : "false");
+	}
+
+	inline void View(const char* Label, const FVector& Value)
+	{
+		ImGui::LabelText(Label, "%.3f, %.3f, %.3f", (double)Value.X, (double)Value.Y, (double)Value.Z);
+	}
+
+	inline void View(const char* Label, const FVector2D& Value)
+	{
+		ImGui::LabelText(Label, "%.3f, %.3f", (double)Value.X, (double)Value.Y);
+	}
+
+	inline void View(const char* Label, const FRotator& Value)
+	{
+		ImGui::LabelText(Label, "%.3f, %.3f, %.3f", (double)Value.Pitch, (double)Value.Yaw, (double)Value.Roll);
+	}
+
+	inline void View(const char* Label, const FLinearColor& Value)
+	{
+		FLinearColor Color = Value;
+		ImGui::BeginDisabled();
+		ImGui::ColorEdit4(Label, &Color.R, ImGuiColorEditFlags_NoPicker);
+		ImGui::EndDisabled();
+	}
+
+	inline void View(const char* Label, const FColor& Value)
+	{
+		View(Label, Value.ReinterpretAsLinear());
+	}
+
+	inline void View(const char* Label, const FString& Value)
+	{
+		ImGui::LabelText(Label, "%s", FImGuiStrings::ToUTF8(Value));
+	}
+
+	inline void View(const char* Label, const FName& Value)
+	{
+		ImGui::LabelText(Label, "%s", FImGuiStrings::ToUTF8(Value));
+	}
+
+	template<typename T>
+	typename TEnableIf<TScalar<T>::bSupported>::Type View(const char* Label, const T& Value)
+	{
+		ImGui::LabelText(Label, TScalar<T>::Format, static_cast<typename TScalar<T>::FPrintType>(Value));
+	}
+
+	template<typename T>
+	typename TEnableIf<std::is_enum<T>::value>::Type View(const char* Label, const T& Value)
+	{
+		View(Label, static_cast<typename std::underlying_type<T>::type>(Value));
+	}
+
+	template<typename T>
+	typename TEnableIf<TImGuiStructFields<T>::bDefined>::Type View(const char* Label, const T& Value)
+	{
+		if (ImGui::TreeNode(Label))
+		{
+			ViewFields(Value);
+			ImGui::TreePop();
+		}
+	}
+
+	template<typename T, typename TAllocator>
+	void View(const char* Label, const TArray<T, TAllocator>& Values)
+	{
+		if (ImGui::TreeNode(Label, "%s [%d]", Label, Values.Num()))
+		{
+			for (int32 Index = 0; Index < Values.Num(); Index++)
+			{
+				char ElementLabel[16];
+				FCStringAnsi::Snprintf(ElementLabel, sizeof(ElementLabel), "[%d]", Index);
+				View(ElementLabel, Values[Index]);
+			}
+			ImGui::TreePop();
+		}
+	}
+}
+
+namespace ImGui
+{
+	/**
+	 * Draw a tree node with editors of all listed fields of a struct.
+	 * @param Label - Label of the tree node
+	 * @param Value - Struct to edit
+	 * @returns True, if any of the fields changed
+	 */
+	template<typename T>
+	bool EditStruct(const char* Label, T& Value)
+	{
+		static_assert(TImGuiStructFields<T>::bDefined, "Struct fields need to be declared with IMGUI_STRUCT_BEGIN.");
+		return ImGuiStructEditor::Edit(Label, Value);
+	}
+
+	/**
+	 * Draw editors of all listed fields of a struct in the current window.
+	 * @param Value - Struct to edit
+	 * @returns True, if any of the fields changed
+	 */
+	template<typename T>
+	bool EditStructFields(T& Value)
+	{
+		static_assert(TImGuiStructFields<T>::bDefined, "Struct fields need to be declared with IMGUI_STRUCT_BEGIN.");
+		return ImGuiStructEditor::EditFields(Value);
+	}
+
+	/**
+	 * Draw a tree node with values of all listed fields of a struct.
+	 * @param Label - Label of the tree node
+	 * @param Value - Struct to display
+	 */
+	template<typename T>
+	void ViewStruct(const char* Label, const T& Value)
+	{
+		static_assert(TImGuiStructFields<T>::bDefined, "Struct fields need to be declared with IMGUI_STRUCT_BEGIN.");
+		ImGuiStructEditor::View(Label, Value);
+	}
+
+	/**
+	 * Draw values of all listed fields of a struct in the current window.
+	 * @param Value - Struct to display
+	 */
+	template<typename T>
+	void ViewStructFields(const T& Value)
+	{
+		static_assert(TImGuiStructFields<T>::bDefined, "Struct fields need to be declared with IMGUI_STRUCT_BEGIN.");
+		ImGuiStructEditor::ViewFields(Value);
+	}
+}
@@ -107,6 +107,10 @@
 //---- ...Or use Dear ImGui's own very basic math operators.
 #define IMGUI_DEFINE_MATH_OPERATORS
 
+// [UnrealImGui] File functions are implemented by the plugin, which writes files on a background thread. TTY logging
+// prints to the Unreal log (see ImFileOpenTTY).
+#define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
+
 //---- Use 32-bit vertex indices (default is 16-bit) is one way to allow large meshes with more than 64K vertices.
 // Your renderer backend will need to support it (most example renderer backends support both 16/32-bit indices).
 // Another way to allow large meshes while keeping 16-bit indices is to handle ImDrawCmd::VtxOffset in your renderer.
@@ -406,6 +406,18 @@ IMGUI_API ImU64             ImFileRead(void* data, ImU64 size, ImU64 count, ImFi
 IMGUI_API ImU64             ImFileWrite(const void* data, ImU64 size, ImU64 count, ImFileHandle file);
 #else
 #define IMGUI_DISABLE_TTY_FUNCTIONS // Can't use stdout, fflush if we are not using default file functions
+#ifndef IMGUI_DISABLE_FILE_FUNCTIONS
+// [UnrealImGui] Implemented by the plugin (see ImGuiFileWriter.cpp).
+typedef struct FImGuiFile* ImFileHandle;
+IMGUI_API ImFileHandle      ImFileOpen(const char* filename, const char* mode);
+IMGUI_API bool              ImFileClose(ImFileHandle file);
+IMGUI_API ImU64             ImFileGetSize(ImFileHandle file);
+IMGUI_API ImU64             ImFileRead(void* data, ImU64 size, ImU64 count, ImFileHandle file);
+IMGUI_API ImU64             ImFileWrite(const void* data, ImU64 size, ImU64 count, ImFileHandle file);
+// [UnrealImGui] TTY output is written to a handle which prints to the Unreal log.
+#define IMGUI_HAS_TTY_FILE
+IMGUI_API ImFileHandle      ImFileOpenTTY();
+#endif
 #endif
 IMGUI_API void*             ImFileLoadToMemory(const char* filename, const char* mode, size_t* out_file_size = NULL, int padding_bytes = 0);
 
@@ -1756,7 +1768,7 @@ struct ImGuiStackTool
 //-----------------------------------------------------------------------------
 
 typedef void (*ImGuiContextHookCallback)(ImGuiContext* ctx, ImGuiContextHook* hook);
-enum ImGuiContextHookType { ImGuiContextHookType_NewFramePre, ImGuiContextHookType_NewFramePost, ImGuiContextHookType_EndFramePre, ImGuiContextHookType_EndFramePost, ImGuiContextHookType_RenderPre, ImGuiContextHookType_RenderPost, ImGuiContextHookType_Shutdown, ImGuiContextHookType_PendingRemoval_ };
+enum ImGuiContextHookType { ImGuiContextHookType_NewFramePre, ImGuiContextHookType_NewFramePost, ImGuiContextHookType_EndFramePre, ImGuiContextHookType_EndFramePost, ImGuiContextHookType_RenderPre, ImGuiContextHookType_RenderPost, ImGuiContextHookType_Shutdown, ImGuiContextHookType_BeginWindowPre, ImGuiContextHookType_BeginWindowPost, ImGuiContextHookType_EndWindowPost, ImGuiContextHookType_PendingRemoval_ }; // [UnrealImGui] Added window hooks (in BeginWindowPost the window is g.CurrentWindow)
 
 struct ImGuiContextHook
 {
@@ -1777,6 +1789,7 @@ struct ImGuiContext
 {
     bool                    Initialized;
     bool                    FontAtlasOwnedByContext;            // IO.Fonts-> is owned by the ImGuiContext and will be destructed along with it.
+    bool                    FontAtlasLockedByHost;              // [UnrealImGui] IO.Fonts-> is shared with a host context, which keeps it locked while this context builds its frames, so NewFrame/EndFrame don't lock and unlock it.
     ImGuiIO                 IO;
     ImGuiStyle              Style;
     ImFont*                 Font;                               // (Shortcut) == FontStack.empty() ? IO.Font : FontStack.back()
@@ -1807,6 +1820,7 @@ struct ImGuiContext
     ImVector<ImGuiWindowStackData> CurrentWindowStack;
     ImGuiStorage            WindowsById;                        // Map window's ImGuiID to ImGuiWindow*
     int                     WindowsActiveCount;                 // Number of unique windows submitted by frame
+    ImRect                  WindowsVisibleRect;                 // [UnrealImGui] Part of the display visible to the user. Items of root windows fully outside of it are skipped. Infinite by default.
     ImVec2                  WindowsHoverPadding;                // Padding around resizable windows for which hovering on counts as hovering the window == ImMax(style.TouchExtraPadding, WINDOWS_HOVER_PADDING)
     ImGuiWindow*            CurrentWindow;                      // Window being drawn into
     ImGuiWindow*            HoveredWindow;                      // Window the mouse is hovering. Will typically catch mouse inputs.
@@ -2079,6 +2093,7 @@ struct ImGuiContext
 
         Initialized = false;
         FontAtlasOwnedByContext = shared_font_atlas ? false : true;
+        FontAtlasLockedByHost = false;
         Font = NULL;
         FontSize = FontBaseSize = 0.0f;
         IO.Fonts = shared_font_atlas ? shared_font_atlas : IM_NEW(ImFontAtlas)();
@@ -2094,6 +2109,7 @@ struct ImGuiContext
         InputEventsNextEventId = 1;
 
         WindowsActiveCount = 0;
+        WindowsVisibleRect = ImRect(-FLT_MAX, -FLT_MAX, FLT_MAX, FLT_MAX);
         CurrentWindow = NULL;
         HoveredWindow = NULL;
         HoveredWindowUnderMovingWindow = NULL;
@@ -2339,6 +2355,8 @@ struct IMGUI_API ImGuiWindow
     bool                    Appearing;                          // Set during the frame where the window is appearing (or re-appearing)
     bool                    Hidden;                             // Do not display (== HiddenFrames*** > 0)
     bool                    IsFallbackWindow;                   // Set on the "Debug##Default" window.
+    bool                    Occluded;                           // [UnrealImGui] Set by the plugin on root windows fully covered by opaque windows in front of them. Hides the window in the next frame and skips its items.
+    ImRect                  OpaqueRect;                         // [UnrealImGui] Part of the window covered by opaque background and title bar in the last render (inverted if there is none).
     bool                    IsExplicitChild;                    // Set when passed _ChildWindow, left to false by BeginDocked()
     bool                    HasCloseButton;                     // Set when the window has a close button (p_open != NULL)
     signed char             ResizeBorderHeld;                   // Current border being held for resize (-1: none, otherwise 0-3)
@@ -4549,7 +4549,8 @@ void ImGui::NewFrame()
     UpdateViewportsNewFrame();
 
     // Setup current font and draw list shared data
-    g.IO.Fonts->Locked = true;
+    if (!g.FontAtlasLockedByHost) // [UnrealImGui] Was: unconditional
+        g.IO.Fonts->Locked = true;
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
     ImRect virtual_space(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
@@ -5057,7 +5058,8 @@ void ImGui::EndFrame()
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
 
     // Unlock font atlas
-    g.IO.Fonts->Locked = false;
+    if (!g.FontAtlasLockedByHost) // [UnrealImGui] Was: unconditional
+        g.IO.Fonts->Locked = false;
 
     // Clear Input data for next frame
     g.IO.AppFocusLost = false;
@@ -5993,6 +5995,7 @@ void ImGui::RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar
     // As we highlight the title bar when want_focus is set, multiple reappearing windows will have their title bar highlighted on their reappearing frame.
     const float window_rounding = window->WindowRounding;
     const float window_border_size = window->WindowBorderSize;
+    window->OpaqueRect = ImRect(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX); // [UnrealImGui]
     if (window->Collapsed)
     {
         // Title bar only
@@ -6018,6 +6021,10 @@ void ImGui::RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar
             if (override_alpha)
                 bg_col = (bg_col & ~IM_COL32_A_MASK) | (IM_F32_TO_INT8_SAT(alpha) << IM_COL32_A_SHIFT);
             window->DrawList->AddRectFilled(window->Pos + ImVec2(0, window->TitleBarHeight()), window->Pos + window->Size, bg_col, window_rounding, (flags & ImGuiWindowFlags_NoTitleBar) ? 0 : ImDrawFlags_RoundCornersBottom);
+
+            // [UnrealImGui] Remember the opaque part of the window for occlusion culling.
+            if ((bg_col & IM_COL32_A_MASK) == IM_COL32_A_MASK)
+                window->OpaqueRect = ImRect(window->Pos + ImVec2(0, window->TitleBarHeight()), window->Pos + window->Size);
         }
 
         // Title bar
@@ -6025,8 +6032,16 @@ void ImGui::RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar
         {
             ImU32 title_bar_col = GetColorU32(title_bar_is_highlight ? ImGuiCol_TitleBgActive : ImGuiCol_TitleBg);
             window->DrawList->AddRectFilled(title_bar_rect.Min, title_bar_rect.Max, title_bar_col, window_rounding, ImDrawFlags_RoundCornersTop);
+
+            // [UnrealImGui] Extend the opaque part of the window over the title bar.
+            if ((title_bar_col & IM_COL32_A_MASK) == IM_COL32_A_MASK && !window->OpaqueRect.IsInverted())
+                window->OpaqueRect.Min.y = title_bar_rect.Min.y;
         }
 
+        // [UnrealImGui] Rounded corners are not covered, so only keep the part that is inside of them.
+        if (!window->OpaqueRect.IsInverted())
+            window->OpaqueRect.Expand(-ImCeil(window_rounding * 0.3f));
+
         // Menu bar
         if (flags & ImGuiWindowFlags_MenuBar)
         {
@@ -6223,6 +6238,9 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     IM_ASSERT(g.WithinFrameScope);                  // Forgot to call ImGui::NewFrame()
     IM_ASSERT(g.FrameCountEnded != g.FrameCount);   // Called ImGui::Render() or ImGui::EndFrame() and haven't called ImGui::NewFrame() again yet
 
+    // [UnrealImGui] Notify hooks before anything is done for this window (it is not yet current).
+    CallContextHooks(&g, ImGuiContextHookType_BeginWindowPre);
+
     // Find or create
     ImGuiWindow* window = FindWindowByName(name);
     const bool window_just_created = (window == NULL);
@@ -6872,6 +6890,10 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         if (style.Alpha <= 0.0f)
             window->HiddenFramesCanSkipItems = 1;
 
+        // [UnrealImGui] Hide root windows which are outside of the visible part of the display (e.g. after zooming the canvas in) or occluded by other windows. Child windows follow their parents.
+        if (!(flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_Tooltip)) && !g.LogEnabled && (window->Occluded || !window->Rect().Overlaps(g.WindowsVisibleRect)))
+            window->HiddenFramesCanSkipItems = 1;
+
         // Update the Hidden flag
         bool hidden_regular = (window->HiddenFramesCanSkipItems > 0) || (window->HiddenFramesCannotSkipItems > 0);
         window->Hidden = hidden_regular || (window->HiddenFramesForRenderOnly > 0);
@@ -6891,6 +6913,9 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->SkipItems = skip_items;
     }
 
+    // [UnrealImGui] Notify hooks once the window is current and its visibility for this frame is known.
+    CallContextHooks(&g, ImGuiContextHookType_BeginWindowPost);
+
     // [DEBUG] io.ConfigDebugBeginReturnValue override return value to test Begin/End and BeginChild/EndChild behaviors.
     // (The implicit fallback window is NOT automatically ended allowing it to always be able to receive commands without crashing)
     if (!window->IsFallbackWindow && ((g.IO.ConfigDebugBeginReturnValueOnce && window_just_created) || (g.IO.ConfigDebugBeginReturnValueLoop && g.DebugBeginReturnValueCullDepth == g.CurrentWindowStack.Size)))
@@ -6942,6 +6967,9 @@ void ImGui::End()
     g.CurrentWindowStack.back().StackSizesOnBegin.CompareWithContextState(&g);
     g.CurrentWindowStack.pop_back();
     SetCurrentWindow(g.CurrentWindowStack.Size == 0 ? NULL : g.CurrentWindowStack.back().Window);
+
+    // [UnrealImGui] Notify hooks after the window was popped from the stack.
+    CallContextHooks(&g, ImGuiContextHookType_EndWindowPost);
 }
 
 void ImGui::BringWindowToFocusFront(ImGuiWindow* window)
@@ -12768,6 +12796,9 @@ void ImGui::LogToTTY(int auto_open_depth)
 #ifndef IMGUI_DISABLE_TTY_FUNCTIONS
     LogBegin(ImGuiLogType_TTY, auto_open_depth);
     g.LogFile = stdout;
+#elif defined(IMGUI_HAS_TTY_FILE) // [UnrealImGui] Was: nothing
+    LogBegin(ImGuiLogType_TTY, auto_open_depth);
+    g.LogFile = ImFileOpenTTY();
 #endif
 }
 
@@ -12825,6 +12856,8 @@ void ImGui::LogFinish()
     case ImGuiLogType_TTY:
 #ifndef IMGUI_DISABLE_TTY_FUNCTIONS
         fflush(g.LogFile);
+#elif defined(IMGUI_HAS_TTY_FILE) // [UnrealImGui] Was: nothing
+        ImFileClose(g.LogFile);
 #endif
         break;
     case ImGuiLogType_File:
@@ -12854,7 +12887,7 @@ void ImGui::LogButtons()
     ImGuiContext& g = *GImGui;
 
     PushID("LogButtons");
-#ifndef IMGUI_DISABLE_TTY_FUNCTIONS
+#if !defined(IMGUI_DISABLE_TTY_FUNCTIONS) || defined(IMGUI_HAS_TTY_FILE) // [UnrealImGui] Was: #ifndef IMGUI_DISABLE_TTY_FUNCTIONS
     const bool log_to_tty = Button("Log To TTY"); SameLine();
 #else
     const bool log_to_tty = false;
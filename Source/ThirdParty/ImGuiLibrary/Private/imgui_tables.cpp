@@ -2392,11 +2392,23 @@ void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 // - The contents stray off its clipping rectangle (we only compare the MaxX value, not the MinX value).
 //   Direct ImDrawList calls won't be taken into account by default, if you use them make sure the ImGui:: bounds
 //   matches, by e.g. calling SetCursorScreenPos().
-// - The channel uses more than one draw command itself. We drop all our attempt at merging stuff here..
-//   we could do better but it's going to be rare and probably not worth the hassle.
+// - The channel uses more than one draw command itself, unless the first one uses the column clip rect and all the
+//   others are nested inside it (e.g. child windows or nested tables). [UnrealImGui] Was: "We drop all our attempt at
+//   merging stuff here.. we could do better but it's going to be rare and probably not worth the hassle."
 // Columns for which the draw channel(s) haven't been merged with other will use their own ImDrawCmd.
 //
 // This function is particularly tricky to understand.. take a breath.
+// [UnrealImGui] Channels with multiple draw calls can be merged, as long as the first draw call uses the column clip rect
+// and all the other draw calls are nested inside it. Only draw calls using the column clip rect are extended.
+static bool TableCanMergeDrawChannel(const ImDrawChannel* channel)
+{
+    const ImRect column_clip_rect(channel->_CmdBuffer[0].ClipRect);
+    for (const ImDrawCmd& cmd : channel->_CmdBuffer)
+        if (cmd.UserCallback != NULL || !column_clip_rect.Contains(ImRect(cmd.ClipRect)))
+            return false;
+    return true;
+}
+
 void ImGui::TableMergeDrawChannels(ImGuiTable* table)
 {
     ImGuiContext& g = *GImGui;
@@ -2440,7 +2452,7 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
             ImDrawChannel* src_channel = &splitter->_Channels[channel_no];
             if (src_channel->_CmdBuffer.Size > 0 && src_channel->_CmdBuffer.back().ElemCount == 0 && src_channel->_CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
                 src_channel->_CmdBuffer.pop_back();
-            if (src_channel->_CmdBuffer.Size != 1)
+            if (src_channel->_CmdBuffer.Size == 0 || !TableCanMergeDrawChannel(src_channel)) // [UnrealImGui] Was: _CmdBuffer.Size != 1
                 continue;
 
             // Find out the width of this merge group and check if it will fit in our column
@@ -2533,17 +2545,24 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
                 remaining_count -= merge_group->ChannelsCount;
                 for (int n = 0; n < (size_for_masks_bitarrays_one >> 2); n++)
                     remaining_mask[n] &= ~merge_group->ChannelsMask[n];
+                // [UnrealImGui] Copy channels with a single draw call first, so they are contiguous and merge into one draw call.
+                for (int pass = 0; pass < 2 && merge_channels_count != 0; pass++)
                 for (int n = 0; n < splitter->_Count && merge_channels_count != 0; n++)
                 {
                     // Copy + overwrite new clip rect
                     if (!IM_BITARRAY_TESTBIT(merge_group->ChannelsMask, n))
                         continue;
+                    ImDrawChannel* channel = &splitter->_Channels[n];
+                    if ((channel->_CmdBuffer.Size == 1) != (pass == 0))
+                        continue;
                     IM_BITARRAY_CLEARBIT(merge_group->ChannelsMask, n);
                     merge_channels_count--;
 
-                    ImDrawChannel* channel = &splitter->_Channels[n];
-                    IM_ASSERT(channel->_CmdBuffer.Size == 1 && merge_clip_rect.Contains(ImRect(channel->_CmdBuffer[0].ClipRect)));
-                    channel->_CmdBuffer[0].ClipRect = merge_clip_rect.ToVec4();
+                    const ImVec4 column_clip_rect = channel->_CmdBuffer[0].ClipRect;
+                    IM_ASSERT(merge_clip_rect.Contains(ImRect(column_clip_rect)));
+                    for (ImDrawCmd& cmd : channel->_CmdBuffer)
+                        if (memcmp(&cmd.ClipRect, &column_clip_rect, sizeof(ImVec4)) == 0)
+                            cmd.ClipRect = merge_clip_rect.ToVec4();
                     memcpy(dst_tmp++, channel, sizeof(ImDrawChannel));
                 }
             }